@@ -0,0 +1,8 @@
+TEMPLATE = subdirs
+
+# 性能基准，均可在 offscreen 平台下运行：
+# QT_QPA_PLATFORM=offscreen ./bin/<基准程序>
+SUBDIRS += \
+    timecontral_paint \
+    interaction_latency \
+    playback_timing
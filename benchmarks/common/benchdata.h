@@ -0,0 +1,73 @@
+#ifndef BENCHDATA_H
+#define BENCHDATA_H
+
+#include <QDateTime>
+#include <QVector>
+#include <QColor>
+#include <random>
+#include <algorithm>
+#include "timecontral.h"
+
+/**
+ * @brief 各基准共用的合成数据
+ *
+ * 固定种子生成，每次运行的数据集相同，不同基准之间的结果可以对照
+ */
+namespace BenchData {
+
+// 时间轴数据集覆盖 30 天，时间项在其中均匀分布
+const int kRangeDays = 30;
+
+// 时间段长度 1～120 分钟
+const qint64 kMinSpanMs = 60 * 1000;
+const qint64 kMaxSpanMs = 120 * 60 * 1000;
+
+inline QDateTime rangeStart()
+{
+    return QDateTime(QDate(2024, 1, 1), QTime(0, 0));
+}
+
+inline QDateTime rangeCenter()
+{
+    return rangeStart().addDays(kRangeDays / 2);
+}
+
+// labelEvery：每隔几项带一个标签，0 表示没有标签；spanPercent：时间段占全部时间项的百分比
+inline void populateTimeContral(TimeContral *widget, int itemCount, int labelEvery, int spanPercent)
+{
+    std::mt19937 random(20240101);
+    std::uniform_int_distribution<qint64> offsetMs(0, qint64(kRangeDays) * 24 * 3600 * 1000 - 1);
+    std::uniform_int_distribution<qint64> spanMs(kMinSpanMs, kMaxSpanMs);
+    std::uniform_int_distribution<int> percent(0, 99);
+    const QColor colors[] = { Qt::green, Qt::yellow, Qt::cyan, QColor(255, 128, 0) };
+
+    QDateTime start = rangeStart();
+    widget->setTimeRange(start, start.addDays(kRangeDays));
+    for (int i = 0; i < itemCount; ++i) {
+        QDateTime itemStart = start.addMSecs(offsetMs(random));
+        QString label = labelEvery > 0 && i % labelEvery == 0 ? QStringLiteral("事件 %1").arg(i) : QString();
+        const QColor &color = colors[i % 4];
+        if (percent(random) < spanPercent)
+            widget->addTimeSpan(itemStart, itemStart.addMSecs(spanMs(random)), label, color);
+        else
+            widget->addTimePoint(itemStart, label, color);
+    }
+}
+
+// 从 firstDate 起 days 天内均匀分布的事件时刻（自纪元毫秒，升序）
+inline QVector<qint64> eventTimes(int count, const QDate &firstDate, int days)
+{
+    std::mt19937 random(20240101);
+    qint64 firstMs = QDateTime(firstDate, QTime(0, 0)).toMSecsSinceEpoch();
+    std::uniform_int_distribution<qint64> offsetMs(0, qint64(days) * 24 * 3600 * 1000 - 1);
+
+    QVector<qint64> times(count);
+    for (qint64 &time : times)
+        time = firstMs + offsetMs(random);
+    std::sort(times.begin(), times.end());
+    return times;
+}
+
+} // namespace BenchData
+
+#endif // BENCHDATA_H
@@ -0,0 +1,53 @@
+#ifndef LATENCYSTATS_H
+#define LATENCYSTATS_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief 耗时样本统计
+ *
+ * 样本以纳秒记录，结束后一次排序，按最近秩法取百分位
+ */
+class LatencyStats
+{
+public:
+    void reserve(int count) { m_samples.reserve(count); }
+    void add(qint64 nanoseconds) { m_samples.append(nanoseconds); m_sorted = false; }
+    void clear() { m_samples.clear(); m_sorted = true; }
+
+    int count() const { return m_samples.size(); }
+
+    qint64 total() const
+    {
+        qint64 sum = 0;
+        for (qint64 sample : m_samples)
+            sum += sample;
+        return sum;
+    }
+
+    // percent 取 0～100，没有样本时返回 0
+    qint64 percentile(double percent)
+    {
+        if (m_samples.isEmpty())
+            return 0;
+        if (!m_sorted) {
+            std::sort(m_samples.begin(), m_samples.end());
+            m_sorted = true;
+        }
+        int rank = int(std::ceil(percent / 100.0 * m_samples.size()));
+        return m_samples.at(qBound(0, rank - 1, m_samples.size() - 1));
+    }
+
+    qint64 max() { return percentile(100.0); }
+
+    static double toMs(qint64 nanoseconds) { return nanoseconds / 1e6; }
+
+private:
+    QVector<qint64> m_samples;
+    bool m_sorted = true;
+};
+
+#endif // LATENCYSTATS_H
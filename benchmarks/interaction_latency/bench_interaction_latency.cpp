@@ -0,0 +1,337 @@
+#include <QtTest>
+#include <QApplication>
+#include <QMouseEvent>
+#include <QWheelEvent>
+#include <QElapsedTimer>
+#include <QScopedPointer>
+#include <cmath>
+#include "timecontral.h"
+#include "datecontrol.h"
+#include "benchdata.h"
+#include "latencystats.h"
+
+namespace {
+
+// 脚本中的一步输入
+struct InputStep {
+    enum Kind { Press, Move, Release, Wheel, PixelWheel };
+    Kind kind;
+    QPoint pos;
+    int delta;      // Wheel 为角度增量（120 为一格），PixelWheel 为像素增量
+};
+
+typedef QVector<InputStep> InputScript;
+
+// 订阅方数量：模拟联动的时钟、标签、缩略图等，每个做少量格式化工作
+const int kListeners = 8;
+
+// 日历数据集覆盖 20 年
+const QDate kCalendarFirstDate(2015, 1, 1);
+const QDate kCalendarLastDate(2034, 12, 31);
+const QDate kCalendarStartDate(2024, 6, 15);
+
+// 拖动平移：按下后沿 step 方向移动 moves 次并松开，来回 strokes 次，视口不会一路漂出数据集；
+// 垂直于拖动方向带 ±2 像素的抖动，接近手的轨迹
+InputScript dragScript(const QPoint &from, const QPoint &step, int moves, int strokes)
+{
+    InputScript script;
+    QPoint normal(step.y() != 0 ? 1 : 0, step.x() != 0 ? 1 : 0);
+    for (int stroke = 0; stroke < strokes; ++stroke) {
+        bool forward = stroke % 2 == 0;
+        QPoint start = forward ? from : from + step * moves;
+        QPoint direction = forward ? step : -step;
+        script.append({ InputStep::Press, start, 0 });
+        for (int i = 1; i <= moves; ++i) {
+            int jitter = int(std::lround(std::sin(i * 0.7) * 2.0));
+            script.append({ InputStep::Move, start + direction * i + normal * jitter, 0 });
+        }
+        script.append({ InputStep::Release, start + direction * moves, 0 });
+    }
+    return script;
+}
+
+// 滚轮连发：在区域内 bursts 个位置各连发 eventsPerBurst 次，方向交替
+InputScript wheelScript(const QRect &area, InputStep::Kind kind, int delta, int bursts, int eventsPerBurst)
+{
+    InputScript script;
+    for (int burst = 0; burst < bursts; ++burst) {
+        QPoint pos(area.left() + area.width() * (burst + 1) / (bursts + 1), area.center().y());
+        int signedDelta = burst % 2 == 0 ? delta : -delta;
+        for (int i = 0; i < eventsPerBurst; ++i)
+            script.append({ kind, pos, signedDelta });
+    }
+    return script;
+}
+
+// 悬停扫过：在区域内逐行往返移动
+InputScript hoverScript(const QRect &area, int stepPx, int rowStepPx)
+{
+    InputScript script;
+    bool leftToRight = true;
+    for (int y = area.top(); y <= area.bottom(); y += rowStepPx) {
+        for (int offset = 0; offset <= area.width(); offset += stepPx) {
+            int x = leftToRight ? area.left() + offset : area.right() - offset;
+            script.append({ InputStep::Move, QPoint(x, y), 0 });
+        }
+        leftToRight = !leftToRight;
+    }
+    return script;
+}
+
+// 逐个发送输入，记录从发送到由它引起的重绘完成的耗时
+void replay(QWidget *widget, const InputScript &script, LatencyStats &stats)
+{
+    Qt::MouseButtons buttons = Qt::NoButton;
+    QElapsedTimer timer;
+    stats.reserve(script.size());
+
+    for (const InputStep &step : script) {
+        QPointF pos(step.pos);
+        QPointF globalPos(widget->mapToGlobal(step.pos));
+        timer.start();
+
+        switch (step.kind) {
+        case InputStep::Press: {
+            buttons = Qt::LeftButton;
+            QMouseEvent event(QEvent::MouseButtonPress, pos, globalPos, Qt::LeftButton, buttons, Qt::NoModifier);
+            QApplication::sendEvent(widget, &event);
+            break;
+        }
+        case InputStep::Move: {
+            QMouseEvent event(QEvent::MouseMove, pos, globalPos, Qt::NoButton, buttons, Qt::NoModifier);
+            QApplication::sendEvent(widget, &event);
+            break;
+        }
+        case InputStep::Release: {
+            buttons = Qt::NoButton;
+            QMouseEvent event(QEvent::MouseButtonRelease, pos, globalPos, Qt::LeftButton, buttons, Qt::NoModifier);
+            QApplication::sendEvent(widget, &event);
+            break;
+        }
+        case InputStep::Wheel:
+        case InputStep::PixelWheel: {
+            QPoint pixelDelta = step.kind == InputStep::PixelWheel ? QPoint(0, step.delta) : QPoint();
+            QWheelEvent event(pos, globalPos, pixelDelta, QPoint(0, step.delta), buttons,
+                              Qt::NoModifier, Qt::NoScrollPhase, false);
+            QApplication::sendEvent(widget, &event);
+            break;
+        }
+        }
+
+        // 事件中的 update() 以 UpdateRequest 投递，这里同步处理，返回时重绘已完成
+        QCoreApplication::sendPostedEvents();
+        stats.add(timer.nsecsElapsed());
+    }
+}
+
+void report(LatencyStats &stats)
+{
+    double seconds = stats.total() / 1e9;
+    qInfo("%d events: p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms, %.0f events/s",
+          stats.count(),
+          LatencyStats::toMs(stats.percentile(50)),
+          LatencyStats::toMs(stats.percentile(90)),
+          LatencyStats::toMs(stats.percentile(99)),
+          LatencyStats::toMs(stats.max()),
+          seconds > 0 ? stats.count() / seconds : 0.0);
+}
+
+} // namespace
+
+/**
+ * @brief 交互延迟基准
+ *
+ * 对 TimeContral 和 DateControl 回放合成的拖动平移、滚轮连发和悬停扫过脚本，
+ * 每个输入单独计时，从发送事件到它引起的重绘完成，包括命中测试、提示文本构建
+ * 和信号扇出。每组数据输出延迟百分位和每秒可处理的事件数
+ */
+class BenchInteractionLatency : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanupTestCase();
+
+    void timeContral_data();
+    void timeContral();
+
+    void dateControl_data();
+    void dateControl();
+
+private:
+    void prepareTimeContral(int itemCount);
+    void prepareDateControl(int eventCount);
+
+    QScopedPointer<TimeContral> m_timeContral;
+    int m_timeContralItems = -1;
+    QScopedPointer<DateControl> m_dateControl;
+    int m_dateControlEvents = -1;
+
+    // 订阅方的输出，防止工作被优化掉
+    qint64 m_sink = 0;
+};
+
+void BenchInteractionLatency::cleanupTestCase()
+{
+    m_timeContral.reset();
+    m_dateControl.reset();
+    qInfo("listener sink: %lld", m_sink);
+}
+
+void BenchInteractionLatency::prepareTimeContral(int itemCount)
+{
+    if (itemCount == m_timeContralItems)
+        return;
+
+    // 构建时控件尚未显示，添加时间项不会触发绘制
+    m_timeContral.reset(new TimeContral);
+    BenchData::populateTimeContral(m_timeContral.data(), itemCount, 100, 50);
+    m_timeContral->resize(1280, 100);
+    m_timeContralItems = itemCount;
+
+    for (int i = 0; i < kListeners; ++i) {
+        connect(m_timeContral.data(), &TimeContral::visibleTimeRangeChanged, this,
+                [this](const QDateTime &from, const QDateTime &to) {
+                    m_sink += from.toString(Qt::ISODate).size() + to.toString(Qt::ISODate).size();
+                });
+        connect(m_timeContral.data(), &TimeContral::currentTimeItemChanged, this,
+                [this](int index) { m_sink += index; });
+    }
+
+    m_timeContral->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_timeContral.data()));
+}
+
+void BenchInteractionLatency::timeContral_data()
+{
+    QTest::addColumn<QString>("scenario");
+    QTest::addColumn<int>("itemCount");
+
+    // 同一数据集的行相邻，只在数据集变化时重建控件
+    const int itemCounts[] = { 1000, 100000, 1000000 };
+    const char *const scenarios[] = { "drag", "wheel", "hover" };
+    for (int count : itemCounts) {
+        for (const char *scenario : scenarios)
+            QTest::addRow("%s, %d items", scenario, count) << QString(scenario) << count;
+    }
+}
+
+void BenchInteractionLatency::timeContral()
+{
+    QFETCH(QString, scenario);
+    QFETCH(int, itemCount);
+
+    prepareTimeContral(itemCount);
+    if (QTest::currentTestFailed())
+        return;
+
+    // 每个场景都从同一视口开始：数据集中点前后各 12 小时
+    QDateTime center = BenchData::rangeCenter();
+    m_timeContral->setVisibleTimeRange(center.addSecs(-12 * 3600), center.addSecs(12 * 3600));
+    m_timeContral->setCurrentTime(center);
+    m_timeContral->repaint();
+
+    QRect area = m_timeContral->rect();
+    InputScript script;
+    if (scenario == "drag") {
+        script = dragScript(QPoint(area.width() * 3 / 4, area.height() / 2), QPoint(-4, 0), 200, 6);
+    } else if (scenario == "wheel") {
+        script = wheelScript(area, InputStep::Wheel, 120, 6, 10);
+    } else {
+        // 沿时间项所在的基线上下三行扫过
+        int baseline = area.height() - 50;
+        script = hoverScript(QRect(0, baseline - 6, area.width(), 13), 3, 6);
+    }
+
+    LatencyStats stats;
+    replay(m_timeContral.data(), script, stats);
+    report(stats);
+}
+
+void BenchInteractionLatency::prepareDateControl(int eventCount)
+{
+    if (eventCount == m_dateControlEvents)
+        return;
+
+    m_dateControl.reset(new DateControl);
+    m_dateControl->resize(400, 530);
+    m_dateControl->setAnimationEnabled(false);
+    m_dateControl->setDateRange(kCalendarFirstDate, kCalendarLastDate);
+    m_dateControl->setEventTimestamps(BenchData::eventTimes(eventCount, kCalendarFirstDate,
+                                                            kCalendarFirstDate.daysTo(kCalendarLastDate) + 1));
+    m_dateControl->setHeatmapMode(DateControl::HeatmapShading);
+    m_dateControlEvents = eventCount;
+
+    for (int i = 0; i < kListeners; ++i) {
+        connect(m_dateControl.data(), &DateControl::currentDateChanged, this,
+                [this](const QDate &date) { m_sink += date.toString(Qt::ISODate).size(); });
+        connect(m_dateControl.data(), &DateControl::dateSelectionChanged, this,
+                [this](const QDate &date) { m_sink += date.toString(Qt::ISODate).size(); });
+    }
+
+    m_dateControl->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_dateControl.data()));
+}
+
+void BenchInteractionLatency::dateControl_data()
+{
+    QTest::addColumn<QString>("scenario");
+    QTest::addColumn<int>("eventCount");
+
+    // 月视图：悬停扫过日期格、滚轮翻月；连续视图：拖动和触控板按像素滚动
+    const int eventCounts[] = { 0, 100000, 1000000 };
+    const char *const scenarios[] = { "hover", "wheel", "drag", "pixel wheel" };
+    for (int count : eventCounts) {
+        for (const char *scenario : scenarios)
+            QTest::addRow("%s, %d events", scenario, count) << QString(scenario) << count;
+    }
+}
+
+void BenchInteractionLatency::dateControl()
+{
+    QFETCH(QString, scenario);
+    QFETCH(int, eventCount);
+
+    prepareDateControl(eventCount);
+    if (QTest::currentTestFailed())
+        return;
+
+    bool continuous = scenario == "drag" || scenario == "pixel wheel";
+    m_dateControl->setViewMode(continuous ? DateControl::ContinuousView : DateControl::MonthView);
+    m_dateControl->setCurrentDate(kCalendarStartDate);
+    m_dateControl->setSelectedDate(kCalendarStartDate);
+    m_dateControl->repaint();
+
+    // 避开标题栏和底部日期栏，只覆盖日期区域
+    QRect area = m_dateControl->rect().adjusted(10, 100, -10, -60);
+    InputScript script;
+    if (scenario == "hover") {
+        script = hoverScript(area, 6, 12);
+    } else if (scenario == "wheel") {
+        script = wheelScript(area, InputStep::Wheel, 120, 6, 10);
+    } else if (scenario == "drag") {
+        script = dragScript(QPoint(area.center().x(), area.bottom()), QPoint(0, -4), 60, 6);
+    } else {
+        script = wheelScript(area, InputStep::PixelWheel, 30, 6, 20);
+    }
+
+    LatencyStats stats;
+    replay(m_dateControl.data(), script, stats);
+    report(stats);
+
+    // 松开后的惯性滚动由帧驱动推进，等它停下再进入下一组
+    QTest::qWait(500);
+}
+
+int main(int argc, char *argv[])
+{
+    // 默认使用 offscreen 平台，没有显示环境时也能运行
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    BenchInteractionLatency bench;
+    return QTest::qExec(&bench, argc, argv);
+}
+
+#include "bench_interaction_latency.moc"
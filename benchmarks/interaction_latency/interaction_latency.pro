@@ -0,0 +1,46 @@
+QT += core gui widgets testlib
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = bench_interaction_latency
+TEMPLATE = app
+
+INCLUDEPATH += . \
+    ../common \
+    ../../timeControl \
+    ../../dateControl \
+    ../../timeline
+
+# 直接包含被测控件的源文件
+SOURCES += \
+    bench_interaction_latency.cpp \
+    ../../timeControl/timecontral.cpp \
+    ../../dateControl/datecontrol.cpp \
+    ../../dateControl/monthgrid.cpp \
+    ../../dateControl/glyphatlas.cpp \
+    ../../dateControl/dayheatmap.cpp \
+    ../../dateControl/datebitset.cpp \
+    ../../dateControl/lunarcalendar.cpp \
+    ../../dateControl/holidaytable.cpp \
+    ../../timeline/framedriver.cpp
+
+HEADERS += \
+    ../common/benchdata.h \
+    ../common/latencystats.h \
+    ../../timeControl/timeContral_global.h \
+    ../../timeControl/timecontral.h \
+    ../../dateControl/datecontrol.h \
+    ../../dateControl/civildate.h \
+    ../../dateControl/monthgrid.h \
+    ../../dateControl/glyphatlas.h \
+    ../../dateControl/dayheatmap.h \
+    ../../dateControl/datebitset.h \
+    ../../dateControl/lunarcalendar.h \
+    ../../dateControl/holidaytable.h \
+    ../../timeline/framedriver.h
+
+DEFINES += TIMECONTRAL_LIBRARY
+
+# 设置输出目录
+DESTDIR = $$PWD/../bin
@@ -0,0 +1,239 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QVector>
+#include <QStringList>
+#include <cmath>
+#include <cstdio>
+#include "timeplaycontrol.h"
+#include "timecontral.h"
+#include "benchdata.h"
+#include "latencystats.h"
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace {
+
+// 进程 CPU 时间（纳秒），包括所有线程
+qint64 processCpuNs()
+{
+#if defined(Q_OS_WIN)
+    FILETIME creation, exit, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+        return 0;
+    auto ticks = [](const FILETIME &time) {
+        return (qint64(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+    return (ticks(kernel) + ticks(user)) * 100;
+#else
+    timespec ts;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0)
+        return 0;
+    return qint64(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief 合成负载
+ *
+ * 0 毫秒定时器反复占用事件循环 chunkMs 毫秒，模拟布局、数据处理等同线程工作，
+ * 每次还让一个控件整体重绘；节拍只能在两块负载之间插进来。负载自身的 CPU 时间
+ * 单独累计，便于从进程 CPU 时间中扣除
+ */
+class SyntheticLoad : public QObject
+{
+public:
+    SyntheticLoad(int chunkMs, QWidget *paintTarget)
+        : m_chunkMs(chunkMs)
+        , m_paintTarget(paintTarget)
+        , m_cpuNs(0)
+        , m_sink(0)
+    {
+        m_timer.setInterval(0);
+        QObject::connect(&m_timer, &QTimer::timeout, this, [this]() { runChunk(); });
+    }
+
+    void start()
+    {
+        if (m_chunkMs > 0)
+            m_timer.start();
+    }
+
+    void stop() { m_timer.stop(); }
+    qint64 cpuNs() const { return m_cpuNs; }
+    quint64 sink() const { return m_sink; }
+
+private:
+    void runChunk()
+    {
+        qint64 cpuStart = processCpuNs();
+        QElapsedTimer busy;
+        busy.start();
+        while (busy.elapsed() < m_chunkMs)
+            m_sink += qHash(busy.nsecsElapsed());
+        m_paintTarget->update();
+        m_cpuNs += processCpuNs() - cpuStart;
+    }
+
+    QTimer m_timer;
+    int m_chunkMs;
+    QWidget *m_paintTarget;
+    qint64 m_cpuNs;
+    quint64 m_sink;
+};
+
+struct RunResult {
+    int emissions;
+    int nominalIntervalMs;
+    LatencyStats jitter;        // 相邻两次 currentTimeChanged 的间隔与节拍间隔之差（绝对值）
+    LatencyStats drift;         // 显示时间落后（或超前）墙钟的量，按墙钟纳秒计（绝对值）
+    double finalDriftMs;        // 最后一次发出时的带符号偏差，正值表示落后
+    double cpuMsPerHour;        // 每模拟一小时媒体时间，播放和界面占用的 CPU 毫秒
+};
+
+// 以 speed 倍速播放 durationMs 毫秒墙钟时间，同时运行 loadChunkMs 的合成负载
+RunResult runPlayback(double speed, int loadChunkMs, int durationMs, TimeContral *timeline)
+{
+    // 步进间隔取 1 秒：speed 即每墙钟秒推进的媒体秒数
+    TimePlayControl player;
+    player.setStepInterval(1);
+    player.setContinuousPlayback(true);
+
+    QDateTime start = BenchData::rangeCenter();
+    qint64 playedSecs = qint64(std::ceil(speed * durationMs / 1000.0)) + 3600;
+    player.setTimeRange(start.addSecs(-playedSecs), start.addSecs(playedSecs));
+    player.setCurrentTime(start);
+    player.setPlaySpeed(speed);
+    player.show();
+
+    // 界面联动：时间轴跟随播放头，播放期间的覆盖层重绘计入 CPU 时间
+    timeline->setVisibleTimeRange(start, start.addSecs(qMax<qint64>(playedSecs - 3600, 60)));
+    timeline->setCurrentTime(start);
+    QObject::connect(&player, &TimePlayControl::currentTimeChanged, timeline, &TimeContral::setCurrentTime);
+
+    QVector<qint64> wallNs;
+    QVector<qint64> mediaMs;
+    wallNs.reserve(durationMs);
+    mediaMs.reserve(durationMs);
+    QElapsedTimer wall;
+    QObject::connect(&player, &TimePlayControl::currentTimeChanged, &player, [&](const QDateTime &time) {
+        wallNs.append(wall.nsecsElapsed());
+        mediaMs.append(time.toMSecsSinceEpoch());
+    });
+
+    SyntheticLoad load(loadChunkMs, &player);
+    QEventLoop loop;
+    QTimer::singleShot(durationMs, &loop, &QEventLoop::quit);
+
+    qint64 cpuStart = processCpuNs();
+    wall.start();
+    player.play();
+    load.start();
+    loop.exec();
+    load.stop();
+    player.pause();
+    qint64 cpuNs = processCpuNs() - cpuStart - load.cpuNs();
+
+    RunResult result;
+    result.emissions = wallNs.size();
+    result.nominalIntervalMs = player.refreshInterval();
+    result.finalDriftMs = 0.0;
+
+    qint64 startMs = start.toMSecsSinceEpoch();
+    qint64 nominalNs = qint64(result.nominalIntervalMs) * 1000000;
+    for (int i = 0; i < wallNs.size(); ++i) {
+        // 墙钟经过 t 毫秒时媒体时间应前进 speed × t 毫秒，偏差换算回墙钟时间
+        double expectedMs = startMs + speed * wallNs.at(i) / 1e6;
+        double driftNs = (expectedMs - mediaMs.at(i)) / speed * 1e6;
+        result.drift.add(qint64(std::fabs(driftNs)));
+        result.finalDriftMs = driftNs / 1e6;
+        if (i > 0)
+            result.jitter.add(qAbs(wallNs.at(i) - wallNs.at(i - 1) - nominalNs));
+    }
+
+    double simulatedHours = speed * durationMs / 3600000.0;
+    result.cpuMsPerHour = simulatedHours > 0 ? cpuNs / 1e6 / simulatedHours : 0.0;
+    return result;
+}
+
+QVector<double> parseNumbers(const QString &text)
+{
+    QVector<double> numbers;
+    // 空字段转换失败，与无效数字一样跳过
+    for (const QString &part : text.split(',')) {
+        bool ok = false;
+        double value = part.trimmed().toDouble(&ok);
+        if (ok)
+            numbers.append(value);
+    }
+    return numbers;
+}
+
+} // namespace
+
+// 播放计时精度基准：在 0.1～10000 倍速下播放，同时用合成负载占满事件循环，
+// 按单调时钟记录每次 currentTimeChanged，输出节拍抖动和显示时间偏差的百分位，
+// 以及每模拟一小时媒体时间的 CPU 时间
+int main(int argc, char *argv[])
+{
+    // 默认使用 offscreen 平台，没有显示环境时也能运行
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("TimePlayControl playback timing benchmark");
+    parser.addHelpOption();
+    QCommandLineOption durationOption(QStringList() << "d" << "duration",
+                                      "Wall-clock milliseconds per run.", "ms", "3000");
+    QCommandLineOption speedsOption("speeds", "Comma-separated play speeds.", "list",
+                                    "0.1,1,10,100,1000,10000");
+    QCommandLineOption loadsOption("loads", "Comma-separated load chunk lengths in ms, 0 for idle.",
+                                   "list", "0,2,8");
+    parser.addOption(durationOption);
+    parser.addOption(speedsOption);
+    parser.addOption(loadsOption);
+    parser.process(app);
+
+    int durationMs = qMax(100, parser.value(durationOption).toInt());
+    QVector<double> speeds = parseNumbers(parser.value(speedsOption));
+    QVector<double> loads = parseNumbers(parser.value(loadsOption));
+
+    // 与播放控件同时显示的时间轴，10 万个时间项
+    TimeContral timeline;
+    BenchData::populateTimeContral(&timeline, 100000, 100, 50);
+    timeline.resize(1280, 100);
+    timeline.show();
+
+    std::printf("%9s %6s %7s %7s | %-31s | %-23s %9s | %14s\n",
+                "speed", "load", "ticks", "nominal",
+                "jitter ms (p50/p90/p99/max)", "drift ms (p50/p99/max)", "final", "CPU ms/sim h");
+    for (double load : loads) {
+        for (double speed : speeds) {
+            if (speed <= 0)
+                continue;
+            RunResult r = runPlayback(speed, int(load), durationMs, &timeline);
+            std::printf("%8gx %4dms %7d %5dms | %7.3f %7.3f %7.3f %7.3f | %7.3f %7.3f %7.3f %9.3f | %14.3f\n",
+                        speed, int(load), r.emissions, r.nominalIntervalMs,
+                        LatencyStats::toMs(r.jitter.percentile(50)),
+                        LatencyStats::toMs(r.jitter.percentile(90)),
+                        LatencyStats::toMs(r.jitter.percentile(99)),
+                        LatencyStats::toMs(r.jitter.max()),
+                        LatencyStats::toMs(r.drift.percentile(50)),
+                        LatencyStats::toMs(r.drift.percentile(99)),
+                        LatencyStats::toMs(r.drift.max()),
+                        r.finalDriftMs,
+                        r.cpuMsPerHour);
+            std::fflush(stdout);
+        }
+    }
+
+    return 0;
+}
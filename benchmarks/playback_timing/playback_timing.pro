@@ -0,0 +1,37 @@
+QT += core gui widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = bench_playback_timing
+TEMPLATE = app
+
+INCLUDEPATH += . \
+    ../common \
+    ../../timeControl \
+    ../../timePlay \
+    ../../timeline
+
+# 直接包含被测控件的源文件
+SOURCES += \
+    bench_playback_timing.cpp \
+    ../../timeControl/timecontral.cpp \
+    ../../timePlay/timeplaycontrol.cpp \
+    ../../timePlay/playhead.cpp \
+    ../../timePlay/playbackclock.cpp \
+    ../../timeline/framedriver.cpp
+
+HEADERS += \
+    ../common/benchdata.h \
+    ../common/latencystats.h \
+    ../../timeControl/timeContral_global.h \
+    ../../timeControl/timecontral.h \
+    ../../timePlay/timeplaycontrol.h \
+    ../../timePlay/playhead.h \
+    ../../timePlay/playbackclock.h \
+    ../../timeline/framedriver.h
+
+DEFINES += TIMECONTRAL_LIBRARY
+
+# 设置输出目录
+DESTDIR = $$PWD/../bin
@@ -0,0 +1,193 @@
+#include <QtTest>
+#include <QApplication>
+#include <QScopedPointer>
+#include "timecontral.h"
+#include "benchdata.h"
+
+namespace {
+
+const int kWidgetHeight = 100;
+
+} // namespace
+
+/**
+ * @brief TimeContral 绘制基准
+ *
+ * 在 offscreen 平台下对同一控件反复 repaint()，QBENCHMARK 给出每帧耗时，
+ * 每组数据另外输出可见范围内的时间项数。0、1千、10万、100万个时间项上
+ * 分别改变可见范围、标签密度、时间段比例和控件宽度
+ */
+class BenchTimeContralPaint : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cleanupTestCase();
+
+    // 静态图层整层重绘：拖动、缩放和数据变化时每帧的工作量
+    void fullFrame_data();
+    void fullFrame();
+
+    // 静态图层命中，只叠加当前时间指示器：播放时每帧的工作量
+    void overlayFrame_data();
+    void overlayFrame();
+
+private:
+    void addRows();
+    void prepareWidget();
+    int itemsInView() const;
+
+    QScopedPointer<TimeContral> m_widget;
+    QString m_datasetKey;
+};
+
+void BenchTimeContralPaint::cleanupTestCase()
+{
+    m_widget.reset();
+}
+
+void BenchTimeContralPaint::addRows()
+{
+    QTest::addColumn<int>("itemCount");
+    QTest::addColumn<int>("visibleMinutes");
+    QTest::addColumn<int>("labelEvery");      // 每隔几项带一个标签，0 表示没有标签
+    QTest::addColumn<int>("spanPercent");     // 时间段占全部时间项的百分比
+    QTest::addColumn<int>("widgetWidth");
+
+    const int hour = 60;
+    const int day = 24 * hour;
+    const int month = BenchData::kRangeDays * day;
+
+    // 同一数据集的行相邻，只在数据集变化时重建控件
+    const int itemCounts[] = { 0, 1000, 100000, 1000000 };
+    for (int count : itemCounts) {
+        // 基准组合：一天可见、每 100 项一个标签、一半时间段、1280 像素宽
+        QTest::addRow("%d items, 1 day", count) << count << day << 100 << 50 << 1280;
+
+        // 可见范围
+        QTest::addRow("%d items, 1 hour", count) << count << hour << 100 << 50 << 1280;
+        QTest::addRow("%d items, 30 days", count) << count << month << 100 << 50 << 1280;
+
+        // 控件宽度
+        QTest::addRow("%d items, 1 day, 640px", count) << count << day << 100 << 50 << 640;
+        QTest::addRow("%d items, 1 day, 3840px", count) << count << day << 100 << 50 << 3840;
+
+        // 没有时间项时标签和时间段比例没有意义
+        if (count == 0)
+            continue;
+
+        // 标签密度
+        QTest::addRow("%d items, 1 day, no labels", count) << count << day << 0 << 50 << 1280;
+        QTest::addRow("%d items, 1 day, all labelled", count) << count << day << 1 << 50 << 1280;
+
+        // 时间段与时间点比例
+        QTest::addRow("%d items, 1 day, points only", count) << count << day << 100 << 0 << 1280;
+        QTest::addRow("%d items, 1 day, spans only", count) << count << day << 100 << 100 << 1280;
+    }
+}
+
+void BenchTimeContralPaint::prepareWidget()
+{
+    QFETCH(int, itemCount);
+    QFETCH(int, visibleMinutes);
+    QFETCH(int, labelEvery);
+    QFETCH(int, spanPercent);
+    QFETCH(int, widgetWidth);
+
+    // 数据集变化时重建控件；构建时控件尚未显示，添加时间项不会触发绘制
+    QString key = QStringLiteral("%1/%2/%3").arg(itemCount).arg(labelEvery).arg(spanPercent);
+    if (key != m_datasetKey) {
+        m_widget.reset(new TimeContral);
+        BenchData::populateTimeContral(m_widget.data(), itemCount, labelEvery, spanPercent);
+        m_datasetKey = key;
+
+        m_widget->show();
+        QVERIFY(QTest::qWaitForWindowExposed(m_widget.data()));
+    }
+
+    m_widget->resize(widgetWidth, kWidgetHeight);
+
+    // 可见范围以数据集中点为中心
+    QDateTime center = BenchData::rangeCenter();
+    qint64 halfVisibleSecs = qint64(visibleMinutes) * 30;
+    m_widget->setVisibleTimeRange(center.addSecs(-halfVisibleSecs), center.addSecs(halfVisibleSecs));
+    m_widget->setCurrentTime(center);
+    QCoreApplication::processEvents();
+
+    // 预热：字体、画刷等首次使用的开销不计入测量
+    m_widget->repaint();
+
+    qInfo("items in view: %d of %d", itemsInView(), m_widget->timeItemCount());
+}
+
+int BenchTimeContralPaint::itemsInView() const
+{
+    // 与 drawTimeItems 的可见性判断一致
+    QDateTime visibleStart = m_widget->visibleStartTime();
+    QDateTime visibleEnd = m_widget->visibleEndTime();
+    int count = 0;
+    for (int i = 0; i < m_widget->timeItemCount(); ++i) {
+        TimeContral::TimeItem item = m_widget->timeItemAt(i);
+        if (item.endTime >= visibleStart && item.startTime <= visibleEnd)
+            ++count;
+    }
+    return count;
+}
+
+void BenchTimeContralPaint::fullFrame_data()
+{
+    addRows();
+}
+
+void BenchTimeContralPaint::fullFrame()
+{
+    prepareWidget();
+    if (QTest::currentTestFailed())
+        return;
+
+    QDateTime visibleStart = m_widget->visibleStartTime();
+    QDateTime visibleEnd = m_widget->visibleEndTime();
+    int nudgeSecs = 0;
+
+    QBENCHMARK {
+        // 可见范围来回平移 1 秒使静态图层失效，与拖动时每帧的工作量一致
+        nudgeSecs ^= 1;
+        m_widget->setVisibleTimeRange(visibleStart.addSecs(nudgeSecs), visibleEnd.addSecs(nudgeSecs));
+        m_widget->repaint();
+    }
+}
+
+void BenchTimeContralPaint::overlayFrame_data()
+{
+    addRows();
+}
+
+void BenchTimeContralPaint::overlayFrame()
+{
+    prepareWidget();
+    if (QTest::currentTestFailed())
+        return;
+
+    QDateTime center = m_widget->currentTime();
+    int stepSecs = 0;
+
+    QBENCHMARK {
+        // 当前时间来回移动 1 秒，静态图层保持有效
+        stepSecs ^= 1;
+        m_widget->setCurrentTime(center.addSecs(stepSecs));
+        m_widget->repaint();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // 默认使用 offscreen 平台，没有显示环境时也能运行
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    BenchTimeContralPaint bench;
+    return QTest::qExec(&bench, argc, argv);
+}
+
+#include "bench_timecontral_paint.moc"
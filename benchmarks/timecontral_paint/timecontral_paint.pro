@@ -0,0 +1,26 @@
+QT += core gui widgets testlib
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = bench_timecontral_paint
+TEMPLATE = app
+
+INCLUDEPATH += . \
+    ../common \
+    ../../timeControl
+
+# 直接包含被测控件的源文件
+SOURCES += \
+    bench_timecontral_paint.cpp \
+    ../../timeControl/timecontral.cpp
+
+HEADERS += \
+    ../common/benchdata.h \
+    ../../timeControl/timeContral_global.h \
+    ../../timeControl/timecontral.h
+
+DEFINES += TIMECONTRAL_LIBRARY
+
+# 设置输出目录
+DESTDIR = $$PWD/../bin
@@ -0,0 +1,86 @@
+#ifndef CIVILDATE_H
+#define CIVILDATE_H
+
+#include <QtGlobal>
+#include <QDate>
+
+/**
+ * @brief 公历日期的整数运算
+ * 
+ * 以 1970-01-01 为第 0 天的“纪元日”表示日期，换算只用整数加减乘除，
+ * 不经过 QDate 的逐日推算；算法来自 Howard Hinnant 的 days_from_civil
+ */
+namespace CivilDate {
+
+// QDate 儒略日与纪元日的差值
+constexpr qint64 kJulianDayOfEpoch = 2440588;
+
+struct YearMonthDay {
+    int year;
+    int month;
+    int day;
+};
+
+constexpr bool isLeapYear(int year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+constexpr int daysInMonth(int year, int month)
+{
+    return month == 2 ? (isLeapYear(year) ? 29 : 28)
+                      : (month == 4 || month == 6 || month == 9 || month == 11) ? 30 : 31;
+}
+
+// 公历年月日 -> 纪元日
+constexpr qint64 daysFromCivil(int year, int month, int day)
+{
+    year -= month <= 2;
+    const qint64 era = (year >= 0 ? year : year - 399) / 400;
+    const qint64 yoe = year - era * 400;
+    const qint64 doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const qint64 doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// 纪元日 -> 公历年月日
+constexpr YearMonthDay civilFromDays(qint64 days)
+{
+    days += 719468;
+    const qint64 era = (days >= 0 ? days : days - 146096) / 146097;
+    const qint64 doe = days - era * 146097;
+    const qint64 yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const qint64 doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const qint64 mp = (5 * doy + 2) / 153;
+    const int day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    const int month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    return YearMonthDay{static_cast<int>(yoe + era * 400 + (month <= 2)), month, day};
+}
+
+// ISO 星期：1 = 星期一 … 7 = 星期日（1970-01-01 为星期四）
+constexpr int weekdayFromDays(qint64 days)
+{
+    return static_cast<int>(days >= -3 ? (days + 3) % 7 : (days + 4) % 7 + 6) + 1;
+}
+
+// ISO 周数：所在周的星期四落在哪一年，就按该年计算周次
+constexpr int isoWeekNumber(qint64 days)
+{
+    const qint64 thursday = days - weekdayFromDays(days) + 4;
+    const qint64 jan1 = daysFromCivil(civilFromDays(thursday).year, 1, 1);
+    return static_cast<int>((thursday - jan1) / 7 + 1);
+}
+
+inline qint64 epochDay(const QDate &date)
+{
+    return date.toJulianDay() - kJulianDayOfEpoch;
+}
+
+inline QDate dateFromEpochDay(qint64 days)
+{
+    return QDate::fromJulianDay(days + kJulianDayOfEpoch);
+}
+
+} // namespace CivilDate
+
+#endif // CIVILDATE_H
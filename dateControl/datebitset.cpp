@@ -0,0 +1,158 @@
+#include "datebitset.h"
+#include <QtAlgorithms>
+
+namespace {
+
+const int kWordBits = 64;
+
+// 字内第 from 位（含）到第 to 位（含）的掩码
+inline quint64 spanMask(int from, int to)
+{
+    quint64 high = (to == kWordBits - 1) ? ~quint64(0) : (quint64(1) << (to + 1)) - 1;
+    return high & ~((quint64(1) << from) - 1);
+}
+
+} // namespace
+
+const qint64 DateBitset::kNoDay;
+
+DateBitset::DateBitset()
+    : m_firstDay(0)
+    , m_dayCount(0)
+{
+}
+
+void DateBitset::setRange(qint64 firstEpochDay, qint64 lastEpochDay)
+{
+    if (lastEpochDay < firstEpochDay)
+        return;
+    
+    int dayCount = static_cast<int>(lastEpochDay - firstEpochDay + 1);
+    if (firstEpochDay == m_firstDay && dayCount == m_dayCount)
+        return;
+    
+    DateBitset resized;
+    resized.m_firstDay = firstEpochDay;
+    resized.m_dayCount = dayCount;
+    resized.m_words = QVector<quint64>((dayCount + kWordBits - 1) / kWordBits, 0);
+    
+    // 逐段拷贝原有的选中区间
+    qint64 day = nextSetDay(qMax(firstEpochDay, m_firstDay));
+    while (day != kNoDay && day <= lastEpochDay) {
+        qint64 end = nextClearDay(day);
+        qint64 spanEnd = (end == kNoDay) ? lastDay() : end - 1;
+        resized.setSpan(day, qMin(spanEnd, lastEpochDay));
+        if (end == kNoDay)
+            break;
+        day = nextSetDay(end);
+    }
+    
+    *this = resized;
+}
+
+qint64 DateBitset::firstDay() const
+{
+    return m_firstDay;
+}
+
+qint64 DateBitset::lastDay() const
+{
+    return m_firstDay + m_dayCount - 1;
+}
+
+bool DateBitset::test(qint64 epochDay) const
+{
+    qint64 index = epochDay - m_firstDay;
+    if (index < 0 || index >= m_dayCount)
+        return false;
+    return (m_words.at(int(index / kWordBits)) >> (index % kWordBits)) & 1;
+}
+
+void DateBitset::set(qint64 epochDay, bool on)
+{
+    qint64 index = epochDay - m_firstDay;
+    if (index < 0 || index >= m_dayCount)
+        return;
+    
+    quint64 bit = quint64(1) << (index % kWordBits);
+    quint64 &word = m_words[int(index / kWordBits)];
+    word = on ? (word | bit) : (word & ~bit);
+}
+
+void DateBitset::setSpan(qint64 fromDay, qint64 toDay, bool on)
+{
+    qint64 first = qMax(fromDay, m_firstDay) - m_firstDay;
+    qint64 last = qMin(toDay, lastDay()) - m_firstDay;
+    if (first > last)
+        return;
+    
+    int firstWord = int(first / kWordBits);
+    int lastWord = int(last / kWordBits);
+    quint64 *words = m_words.data();
+    
+    for (int w = firstWord; w <= lastWord; ++w) {
+        int from = (w == firstWord) ? int(first % kWordBits) : 0;
+        int to = (w == lastWord) ? int(last % kWordBits) : kWordBits - 1;
+        quint64 mask = spanMask(from, to);
+        words[w] = on ? (words[w] | mask) : (words[w] & ~mask);
+    }
+}
+
+void DateBitset::clear()
+{
+    m_words.fill(0);
+}
+
+bool DateBitset::isEmpty() const
+{
+    for (quint64 word : m_words) {
+        if (word)
+            return false;
+    }
+    return true;
+}
+
+int DateBitset::count() const
+{
+    int total = 0;
+    for (quint64 word : m_words)
+        total += qPopulationCount(word);
+    return total;
+}
+
+qint64 DateBitset::nextSetDay(qint64 fromDay) const
+{
+    qint64 index = qMax(fromDay, m_firstDay) - m_firstDay;
+    if (index >= m_dayCount)
+        return kNoDay;
+    
+    int w = int(index / kWordBits);
+    quint64 word = m_words.at(w) & ~((quint64(1) << (index % kWordBits)) - 1);
+    while (true) {
+        if (word)
+            return m_firstDay + qint64(w) * kWordBits + qCountTrailingZeroBits(word);
+        if (++w >= m_words.size())
+            return kNoDay;
+        word = m_words.at(w);
+    }
+}
+
+qint64 DateBitset::nextClearDay(qint64 fromDay) const
+{
+    qint64 index = qMax(fromDay, m_firstDay) - m_firstDay;
+    if (index >= m_dayCount)
+        return kNoDay;
+    
+    // 取反后查找置位；末字超出范围的位也会被取反成 1，需要再和范围比较
+    int w = int(index / kWordBits);
+    quint64 word = ~m_words.at(w) & ~((quint64(1) << (index % kWordBits)) - 1);
+    while (true) {
+        if (word) {
+            qint64 day = m_firstDay + qint64(w) * kWordBits + qCountTrailingZeroBits(word);
+            return day <= lastDay() ? day : kNoDay;
+        }
+        if (++w >= m_words.size())
+            return kNoDay;
+        word = ~m_words.at(w);
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef DATEBITSET_H
+#define DATEBITSET_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <limits>
+
+/**
+ * @brief 按纪元日下标的日期位集
+ * 
+ * 每天占 1 位，200 年约 9 KB；区间增删按 64 位字整体处理，
+ * 计数使用 popcount，遍历按字跳过空白，选中十年也只涉及几十个字
+ */
+class DateBitset
+{
+public:
+    // nextSetDay / nextClearDay 找不到时的返回值
+    static const qint64 kNoDay = std::numeric_limits<qint64>::min();
+
+public:
+    DateBitset();
+    
+    // 调整覆盖范围（含首尾），保留重叠部分
+    void setRange(qint64 firstEpochDay, qint64 lastEpochDay);
+    qint64 firstDay() const;
+    qint64 lastDay() const;
+    
+    bool test(qint64 epochDay) const;
+    void set(qint64 epochDay, bool on = true);
+    // 设置 [fromDay, toDay]（含首尾，自动裁剪到覆盖范围）
+    void setSpan(qint64 fromDay, qint64 toDay, bool on = true);
+    void clear();
+    
+    bool isEmpty() const;
+    int count() const;
+    
+    // 从 fromDay（含）开始的第一个选中 / 未选中的日期
+    qint64 nextSetDay(qint64 fromDay) const;
+    qint64 nextClearDay(qint64 fromDay) const;
+
+private:
+    qint64 m_firstDay;
+    int m_dayCount;
+    QVector<quint64> m_words;
+};
+
+#endif // DATEBITSET_H
@@ -1,11 +1,18 @@
 #include "datecontrol.h"
+#include "framedriver.h"
+#include "monthgrid.h"
+#include "civildate.h"
+#include "glyphatlas.h"
+#include "dayheatmap.h"
+#include "datebitset.h"
+#include "lunarcalendar.h"
+#include "holidaytable.h"
 #include <QPainter>
 #include <QMouseEvent>
 #include <QWheelEvent>
 #include <QPaintEvent>
 #include <QResizeEvent>
 #include <QKeyEvent>
-#include <QTimer>
 #include <QDate>
 #include <QLocale>
 #include <QFontMetrics>
@@ -15,6 +22,31 @@
 #include <QEasingCurve>
 #include <QDebug>
 #include <QApplication>
+#include <QtMath>
+#include <cmath>
+
+namespace {
+
+// 切换月份的过渡动画时长（毫秒）
+const int kTransitionDurationMs = 320;
+
+// 连续滚动视图：滚轮每格滚动的周数
+const qreal kWheelStepWeeks = 3.0;
+
+// 平滑滚动逼近目标的速率（每秒），越大越快
+const qreal kScrollSmoothing = 16.0;
+
+// 惯性速度的衰减率（每秒）与停止阈值（周/秒）
+const qreal kFlingDecay = 3.0;
+const qreal kMinFlingVelocity = 0.5;
+
+// 周行缓存中已失效的行
+const qint64 kNoWeek = -1;
+
+// 单元格高度不足时不绘制农历和节假日标注
+const int kMinAnnotatedCellHeight = 36;
+
+} // namespace
 
 // 私有实现类
 class DateControl::Private
@@ -25,6 +57,7 @@ public:
         , currentDate(QDate::currentDate())
         , selectedDate(QDate::currentDate())
         , viewMode(MonthView)
+        , selectionMode(SingleSelection)
         , minDate(QDate(1900, 1, 1))
         , maxDate(QDate(2100, 12, 31))
         , backgroundColor(QColor(41, 128, 185))  // 蓝色背景
@@ -35,18 +68,57 @@ public:
         , weekendColor(QColor(255, 255, 255))
         , showWeekNumbers(false)
         , showToday(true)
+        , showLunar(true)
+        , heatmapMode(NoHeatmap)
+        , heatmapColor(QColor(255, 193, 7))     // 琥珀色热度
 
         , animationEnabled(true)
-        , animationTimer(new QTimer(q))
         , animationProgress(0.0)
+        , animationStartMs(0)
         , isAnimating(false)
         , cellWidth(0)
         , cellHeight(0)
         , headerHeight(50)
+        , yearCacheYear(0)
+        , yearCacheDpr(0)
+        , glyphAtlas(atlasTexts())
+        , annotationAtlas(annotationTexts())
+        , scrollWeeks(0)
+        , scrollTargetWeeks(0)
+        , scrollVelocity(0)
+        , isScrolling(false)
+        , scrollFollowsMonth(false)
+        , lastScrollFrameMs(0)
+        , dragMoved(false)
+        , dragStartWeeks(0)
+        , lastDragMs(0)
+        , weekRowsToday(0)
+        , isDragging(false)
+    {
+    }
+    
+    // 多选模式按位集显示选中，单选模式只显示 selectedDate
+    bool isDaySelected(qint64 day, qint64 selectedDay) const
+    {
+        return selectionMode == MultiSelection ? selection.test(day) : day == selectedDay;
+    }
+    
+    static QStringList atlasTexts()
     {
-        animationTimer->setSingleShot(false);
-        animationTimer->setInterval(16); // ~60 FPS
-        QObject::connect(animationTimer, &QTimer::timeout, q, &DateControl::onAnimationTimer);
+        QStringList texts;
+        for (int i = 1; i <= MonthGrid::kMaxNumberText; ++i)
+            texts.append(MonthGrid::numberText(i));
+        for (int i = 0; i < MonthGrid::kColumns; ++i)
+            texts.append(MonthGrid::weekdayTitle(i));
+        return texts;
+    }
+    
+    static QStringList annotationTexts()
+    {
+        QStringList texts = LunarCalendar::allNames();
+        texts.append(QStringLiteral("休"));
+        texts.append(QStringLiteral("班"));
+        return texts;
     }
 
     DateControl *q;
@@ -55,6 +127,11 @@ public:
     QDate currentDate;
     QDate selectedDate;
     ViewMode viewMode;
+    
+    // 多选集合与 Shift 区间的起点
+    SelectionMode selectionMode;
+    DateBitset selection;
+    QDate selectionAnchor;
     QDate minDate;
     QDate maxDate;
     
@@ -71,15 +148,28 @@ public:
     // 显示选项
     bool showWeekNumbers;
     bool showToday;
+    bool showLunar;
+    
+    // 法定节假日与调休
+    HolidayTable holidays;
+    
+    // 每日记录热度
+    DayHeatmap heatmap;
+    HeatmapMode heatmapMode;
+    QColor heatmapColor;
     
     // 动画
     bool animationEnabled;
-    QTimer *animationTimer;
     double animationProgress;
+    qint64 animationStartMs;
     bool isAnimating;
     QDate animationStartDate;
     QDate animationEndDate;
     
+    // 过渡动画的新旧日历快照，动画期间只做平移合成
+    QPixmap outgoingSnapshot;
+    QPixmap incomingSnapshot;
+    
     // 布局
     int cellWidth;
     int cellHeight;
@@ -87,6 +177,45 @@ public:
     QRect calendarRect;
     QRect headerRect;
     
+    // 月视图网格，月份、布局或日期变化时重建
+    MonthGrid monthGrid;
+    
+    // 年视图的 12 个小月历缓存；年份、尺寸变化时整体失效，选中日期变化时只重画相关月份
+    QPixmap miniMonthCache[12];
+    int yearCacheYear;
+    QSize yearCacheMonthSize;
+    qreal yearCacheDpr;
+    
+    // 日号、周数和星期标题的字形图集
+    GlyphAtlas glyphAtlas;
+    
+    // 农历、节日和“休 / 班”的字形图集，文本多、字号小，与日号分开存放
+    GlyphAtlas annotationAtlas;
+    
+    // 渐变背景缓存，尺寸或设备像素比变化时重画
+    QPixmap backgroundCache;
+    
+    // 连续滚动视图：位置以周为单位，0 对应 minDate 所在的周
+    struct WeekRow {
+        qint64 week;
+        QPixmap pixmap;
+    };
+    qreal scrollWeeks;
+    qreal scrollTargetWeeks;
+    qreal scrollVelocity;        // 周/秒，拖动松手后的惯性
+    bool isScrolling;
+    bool scrollFollowsMonth;     // 用户滚动时由可见区域决定当前月份
+    qint64 lastScrollFrameMs;
+    bool dragMoved;
+    QPoint dragStartPos;
+    qreal dragStartWeeks;
+    qint64 lastDragMs;
+    
+    // 可见周行的渲染结果，滚出可见区域的行被复用给新滚入的行；
+    // weekRowsToday 是渲染时的“今天”，跨过午夜后全部重绘
+    QVector<WeekRow> weekRows;
+    qint64 weekRowsToday;
+    
     // 交互状态
     QDate hoveredDate;
     bool isDragging;
@@ -102,6 +231,8 @@ DateControl::DateControl(QWidget *parent)
     setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
     setMinimumSize(300, 250);
     
+    d->heatmap.setRange(CivilDate::epochDay(d->minDate), CivilDate::epochDay(d->maxDate));
+    d->selection.setRange(CivilDate::epochDay(d->minDate), CivilDate::epochDay(d->maxDate));
     calculateLayout();
 }
 
@@ -115,13 +246,27 @@ void DateControl::setCurrentDate(const QDate &date)
     if (!date.isValid() || d->currentDate == date)
         return;
         
-    if (d->animationEnabled && isVisible()) {
+    // 切换前后各渲染一次日历区域，动画帧只合成这两张快照
+    bool animate = d->animationEnabled && isVisible() && d->viewMode != ContinuousView;
+    if (animate) {
         d->animationStartDate = d->currentDate;
         d->animationEndDate = date;
-        startTransitionAnimation();
+        d->outgoingSnapshot = renderCalendarSnapshot();
     }
     
     d->currentDate = date;
+    
+    if (animate) {
+        d->incomingSnapshot = renderCalendarSnapshot();
+        startTransitionAnimation();
+    }
+    
+    // 连续视图改为滚动到该月第一周
+    if (d->viewMode == ContinuousView) {
+        d->scrollFollowsMonth = false;
+        scrollToWeek(weekOf(QDate(date.year(), date.month(), 1)), true);
+    }
+    
     emit currentDateChanged(date);
     emit monthChanged(date.year(), date.month());
     update();
@@ -137,9 +282,31 @@ void DateControl::setSelectedDate(const QDate &date)
     if (!date.isValid() || d->selectedDate == date)
         return;
         
+    invalidateDateCache(d->selectedDate);
+    invalidateDateCache(date);
+    
+    // 月视图中新旧日期都在当前网格内时，只重画两个单元格和底部日期
+    QRect oldRect = getDateCellRect(d->selectedDate);
+    QRect newRect = getDateCellRect(date);
     d->selectedDate = date;
     emit dateSelectionChanged(date);
-    update();
+    
+    // 连续视图中保持选中日期所在的周可见
+    if (d->viewMode == ContinuousView) {
+        qreal week = weekOf(date);
+        if (week < d->scrollWeeks)
+            scrollToWeek(week, true);
+        else if (week + 1 > d->scrollWeeks + visibleWeekRows())
+            scrollToWeek(week + 1 - visibleWeekRows(), true);
+    }
+    
+    if (oldRect.isValid() && newRect.isValid()) {
+        update(oldRect.adjusted(-1, -1, 1, 1));
+        update(newRect.adjusted(-1, -1, 1, 1));
+        update(getBottomRect());
+    } else {
+        update();
+    }
 }
 
 QDate DateControl::selectedDate() const
@@ -147,6 +314,91 @@ QDate DateControl::selectedDate() const
     return d->selectedDate;
 }
 
+void DateControl::setSelectionMode(SelectionMode mode)
+{
+    if (d->selectionMode == mode)
+        return;
+    
+    d->selectionMode = mode;
+    if (mode == SingleSelection)
+        d->selection.clear();
+    invalidateDateCaches();
+    update();
+}
+
+DateControl::SelectionMode DateControl::selectionMode() const
+{
+    return d->selectionMode;
+}
+
+void DateControl::setDateSelected(const QDate &date, bool selected)
+{
+    if (!date.isValid())
+        return;
+    
+    qint64 day = CivilDate::epochDay(date);
+    if (d->selection.test(day) == selected)
+        return;
+    
+    d->selection.set(day, selected);
+    invalidateDateCache(date);
+    updateDateCell(date);
+    if (d->viewMode != MonthView)
+        update();
+    emit selectionChanged();
+}
+
+void DateControl::selectDateRange(const QDate &from, const QDate &to, bool selected)
+{
+    if (!from.isValid() || !to.isValid())
+        return;
+    
+    // 按字整体置位，选中整十年也只是几十次字操作
+    qint64 first = CivilDate::epochDay(qMin(from, to));
+    qint64 last = CivilDate::epochDay(qMax(from, to));
+    d->selection.setSpan(first, last, selected);
+    invalidateDateCaches();
+    update();
+    emit selectionChanged();
+}
+
+void DateControl::clearSelection()
+{
+    if (d->selection.isEmpty())
+        return;
+    
+    d->selection.clear();
+    invalidateDateCaches();
+    update();
+    emit selectionChanged();
+}
+
+bool DateControl::isDateSelected(const QDate &date) const
+{
+    return date.isValid() && d->selection.test(CivilDate::epochDay(date));
+}
+
+int DateControl::selectedDateCount() const
+{
+    return d->selection.count();
+}
+
+QVector<QPair<QDate, QDate>> DateControl::selectedRanges() const
+{
+    // 交替查找置位和清零位，每段连续选中的日期合成一个区间
+    QVector<QPair<QDate, QDate>> ranges;
+    qint64 day = d->selection.nextSetDay(d->selection.firstDay());
+    while (day != DateBitset::kNoDay) {
+        qint64 end = d->selection.nextClearDay(day);
+        qint64 last = (end == DateBitset::kNoDay) ? d->selection.lastDay() : end - 1;
+        ranges.append(qMakePair(CivilDate::dateFromEpochDay(day), CivilDate::dateFromEpochDay(last)));
+        if (end == DateBitset::kNoDay)
+            break;
+        day = d->selection.nextSetDay(end);
+    }
+    return ranges;
+}
+
 void DateControl::setViewMode(ViewMode mode)
 {
     if (d->viewMode == mode)
@@ -154,6 +406,13 @@ void DateControl::setViewMode(ViewMode mode)
         
     d->viewMode = mode;
     calculateLayout();
+    
+    d->isScrolling = false;
+    d->scrollVelocity = 0;
+    if (mode == ContinuousView) {
+        d->scrollFollowsMonth = false;
+        scrollToWeek(weekOf(QDate(d->currentDate.year(), d->currentDate.month(), 1)), false);
+    }
     emit viewModeChanged(mode);
     update();
 }
@@ -170,6 +429,9 @@ void DateControl::setDateRange(const QDate &minDate, const QDate &maxDate)
         
     d->minDate = minDate;
     d->maxDate = maxDate;
+    d->heatmap.setRange(CivilDate::epochDay(minDate), CivilDate::epochDay(maxDate));
+    d->selection.setRange(CivilDate::epochDay(minDate), CivilDate::epochDay(maxDate));
+    invalidateDateCaches();
     
     // 确保当前日期在范围内
     if (d->currentDate < minDate)
@@ -201,12 +463,14 @@ void DateControl::setBackgroundColor(const QColor &color)
 void DateControl::setHeaderColor(const QColor &color)
 {
     d->headerColor = color;
+    invalidateDateCaches();
     update();
 }
 
 void DateControl::setSelectedColor(const QColor &color)
 {
     d->selectedColor = color;
+    invalidateDateCaches();
     update();
 }
 
@@ -219,6 +483,7 @@ void DateControl::setTodayColor(const QColor &color)
 void DateControl::setTextColor(const QColor &color)
 {
     d->textColor = color;
+    invalidateDateCaches();
     update();
 }
 
@@ -232,6 +497,7 @@ void DateControl::setShowWeekNumbers(bool show)
 {
     d->showWeekNumbers = show;
     calculateLayout();
+    invalidateDateCaches();
     update();
 }
 
@@ -243,6 +509,7 @@ bool DateControl::isShowWeekNumbers() const
 void DateControl::setShowToday(bool show)
 {
     d->showToday = show;
+    invalidateDateCaches();
     update();
 }
 
@@ -251,6 +518,43 @@ bool DateControl::isShowToday() const
     return d->showToday;
 }
 
+void DateControl::setShowLunar(bool show)
+{
+    if (d->showLunar == show)
+        return;
+    
+    d->showLunar = show;
+    invalidateDateCaches();
+    update();
+}
+
+bool DateControl::isShowLunar() const
+{
+    return d->showLunar;
+}
+
+bool DateControl::loadHolidayFile(const QString &fileName, QString *errorMessage)
+{
+    if (!d->holidays.loadFromFile(fileName, errorMessage))
+        return false;
+    
+    // 文件中的节日名称也预先光栅化
+    d->annotationAtlas.setTexts(Private::annotationTexts() + d->holidays.names());
+    invalidateDateCaches();
+    update();
+    return true;
+}
+
+void DateControl::clearHolidays()
+{
+    if (d->holidays.isEmpty())
+        return;
+    
+    d->holidays.clear();
+    invalidateDateCaches();
+    update();
+}
+
 
 
 void DateControl::goToToday()
@@ -301,34 +605,119 @@ bool DateControl::isAnimationEnabled() const
     return d->animationEnabled;
 }
 
+void DateControl::setDayCounts(const QDate &firstDate, const QVector<int> &counts)
+{
+    if (!firstDate.isValid())
+        return;
+    
+    d->heatmap.setCounts(CivilDate::epochDay(firstDate), counts);
+    invalidateDateCaches();
+    update();
+}
+
+void DateControl::setEventTimestamps(const QVector<qint64> &sortedMSecsSinceEpoch)
+{
+    d->heatmap.setTimestamps(sortedMSecsSinceEpoch);
+    invalidateDateCaches();
+    update();
+}
+
+void DateControl::clearDayCounts()
+{
+    if (d->heatmap.isEmpty())
+        return;
+    
+    d->heatmap.clear();
+    invalidateDateCaches();
+    update();
+}
+
+int DateControl::dayCount(const QDate &date) const
+{
+    return date.isValid() ? d->heatmap.count(CivilDate::epochDay(date)) : 0;
+}
+
+void DateControl::setHeatmapMode(HeatmapMode mode)
+{
+    if (d->heatmapMode == mode)
+        return;
+    
+    d->heatmapMode = mode;
+    invalidateDateCaches();
+    update();
+}
+
+DateControl::HeatmapMode DateControl::heatmapMode() const
+{
+    return d->heatmapMode;
+}
+
+void DateControl::setHeatmapColor(const QColor &color)
+{
+    d->heatmapColor = color;
+    invalidateDateCaches();
+    update();
+}
+
 void DateControl::paintEvent(QPaintEvent *event)
 {
-    Q_UNUSED(event);
+    // 悬停和选中只更新单元格区域，与脏区不相交的部分直接跳过
+    const QRect dirtyRect = event->rect();
     
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
     
     // 绘制背景
-    drawBackground(painter);
+    ensureBackgroundCache();
+    qreal dpr = d->backgroundCache.devicePixelRatio();
+    painter.drawPixmap(dirtyRect, d->backgroundCache,
+                       QRectF(dirtyRect.x() * dpr, dirtyRect.y() * dpr,
+                              dirtyRect.width() * dpr, dirtyRect.height() * dpr));
     
     // 绘制头部
-    drawHeader(painter);
+    if (dirtyRect.intersects(getHeaderRect()))
+        drawHeader(painter);
     
-    // 根据视图模式绘制日历
-    switch (d->viewMode) {
-    case MonthView:
-        drawMonthView(painter);
-        break;
-    case YearView:
-        drawYearView(painter);
-        break;
-    case WeekView:
-        drawWeekView(painter);
-        break;
+    // 根据视图模式绘制日历，过渡期间改为合成快照
+    if (d->isAnimating) {
+        drawTransition(painter);
+    } else {
+        switch (d->viewMode) {
+        case MonthView:
+            drawMonthView(painter, dirtyRect);
+            break;
+        case YearView:
+            drawYearView(painter);
+            break;
+        case WeekView:
+            drawWeekView(painter);
+            break;
+        case ContinuousView:
+            drawContinuousView(painter);
+            break;
+        }
     }
     
     // 绘制底部选中日期显示区域
-    drawBottomDateDisplay(painter);
+    if (dirtyRect.intersects(getBottomRect()))
+        drawBottomDateDisplay(painter);
+}
+
+void DateControl::ensureBackgroundCache()
+{
+    qreal dpr = devicePixelRatioF();
+    if (!d->backgroundCache.isNull() && d->backgroundCache.devicePixelRatio() == dpr
+        && d->backgroundCache.size() == size() * dpr) {
+        return;
+    }
+    
+    d->backgroundCache = QPixmap(size() * dpr);
+    d->backgroundCache.setDevicePixelRatio(dpr);
+    d->backgroundCache.fill(Qt::transparent);
+    
+    QPainter painter(&d->backgroundCache);
+    painter.setRenderHint(QPainter::Antialiasing);
+    drawBackground(painter);
 }
 
 void DateControl::drawBackground(QPainter &painter)
@@ -357,7 +746,7 @@ void DateControl::drawBackground(QPainter &painter)
     painter.drawRoundedRect(rect().adjusted(5, 5, -5, -height() * 0.7), 8, 8);
     
     // 绘制底部日期显示区域背景
-    QRect bottomRect(rect().left() + 15, rect().bottom() - 55, rect().width() - 30, 40);
+    QRect bottomRect = getBottomRect();
     
     // 底部区域的半透明深色背景
     painter.setBrush(QColor(0, 0, 0, 80));
@@ -398,7 +787,7 @@ void DateControl::drawHeader(QPainter &painter)
     painter.setFont(headerFont);
     
     QString headerText;
-    if (d->viewMode == MonthView) {
+    if (d->viewMode == MonthView || d->viewMode == ContinuousView) {
         headerText = QString("%1年 %2月").arg(d->currentDate.year())
                                         .arg(d->currentDate.month());
     } else if (d->viewMode == YearView) {
@@ -413,70 +802,52 @@ void DateControl::drawHeader(QPainter &painter)
     painter.drawText(headerRect, Qt::AlignCenter, headerText);
 }
 
-void DateControl::drawMonthView(QPainter &painter)
+void DateControl::drawMonthView(QPainter &painter, const QRect &dirtyRect)
 {
-    QRect calendarRect = getCalendarRect();
-    
-    // 计算网格
-    int cols = d->showWeekNumbers ? 8 : 7;
-    int rows = 7; // 1行星期标题 + 6行日期
-    
-    d->cellWidth = calendarRect.width() / cols;
-    d->cellHeight = calendarRect.height() / rows;
+    // 网格只在月份、布局或日期变化时重建，这里直接读取
+    ensureMonthGrid();
+    const MonthGrid &grid = d->monthGrid;
+    d->cellWidth = grid.cellWidth();
+    d->cellHeight = grid.cellHeight();
     
     // 绘制星期标题
-    painter.setPen(QColor(255, 255, 255, 180));
     QFont weekFont = font();
     weekFont.setBold(false);
     weekFont.setPointSize(font().pointSize() - 1);
-    painter.setFont(weekFont);
-    
-    QStringList weekDays = {"日", "一", "二", "三", "四", "五", "六"};
     
-    int startCol = d->showWeekNumbers ? 1 : 0;
-    for (int i = 0; i < 7; ++i) {
-        QRect weekRect(calendarRect.left() + (startCol + i) * d->cellWidth,
-                      calendarRect.top(),
-                      d->cellWidth, d->cellHeight);
-        
+    for (int i = 0; i < MonthGrid::kColumns; ++i) {
+        if (!dirtyRect.intersects(grid.weekdayTitleRect(i)))
+            continue;
         QColor weekColor = (i >= 5) ? d->weekendColor : d->textColor;
-        painter.setPen(weekColor);
-        painter.drawText(weekRect, Qt::AlignCenter, weekDays[i]);
+        d->glyphAtlas.drawText(painter, grid.weekdayTitleRect(i), MonthGrid::weekdayTitle(i),
+                               weekFont, weekColor);
     }
     
-    // 绘制日期网格
-    QDate firstDay = QDate(d->currentDate.year(), d->currentDate.month(), 1);
-    QDate startDate = firstDay.addDays(-(firstDay.dayOfWeek() - 1));
-    
-    painter.setFont(font());
-    
-    for (int week = 0; week < 6; ++week) {
-        // 绘制周数
-        if (d->showWeekNumbers) {
-            QDate weekDate = startDate.addDays(week * 7);
-            int weekNumber = weekDate.weekNumber();
-            
-            QRect weekNumRect(calendarRect.left(),
-                            calendarRect.top() + (week + 1) * d->cellHeight,
-                            d->cellWidth, d->cellHeight);
-            
-            painter.setPen(d->textColor.lighter(150));
-            painter.drawText(weekNumRect, Qt::AlignCenter, QString::number(weekNumber));
+    // 绘制周数
+    if (d->showWeekNumbers) {
+        QColor weekNumberColor = d->textColor.lighter(150);
+        for (int week = 0; week < MonthGrid::kRows; ++week) {
+            if (!dirtyRect.intersects(grid.weekNumberRect(week)))
+                continue;
+            d->glyphAtlas.drawText(painter, grid.weekNumberRect(week),
+                                   MonthGrid::numberText(grid.weekNumber(week)), font(), weekNumberColor);
         }
+    }
+    
+    // 绘制日期
+    qint64 selectedDay = CivilDate::epochDay(d->selectedDate);
+    qint64 hoveredDay = d->hoveredDate.isValid() ? CivilDate::epochDay(d->hoveredDate) : 0;
+    for (int i = 0; i < MonthGrid::kCellCount; ++i) {
+        const MonthGrid::Cell &cell = grid.cell(i);
+        if (!dirtyRect.intersects(cell.rect))
+            continue;
+        bool isSelected = d->isDaySelected(cell.epochDay, selectedDay);
+        bool isToday = (cell.flags & MonthGrid::Today) && d->showToday;
+        bool isOtherMonth = !(cell.flags & MonthGrid::CurrentMonth);
+        bool isHovered = d->hoveredDate.isValid() && cell.epochDay == hoveredDay;
         
-        // 绘制日期
-        for (int day = 0; day < 7; ++day) {
-            QDate date = startDate.addDays(week * 7 + day);
-            
-            QRect cellRect(calendarRect.left() + (startCol + day) * d->cellWidth,
-                          calendarRect.top() + (week + 1) * d->cellHeight,
-                          d->cellWidth, d->cellHeight);
-            
-            bool isSelected = (date == d->selectedDate);
-            bool isToday = (date == QDate::currentDate() && d->showToday);
-            
-            drawDateCell(painter, date, cellRect, isSelected, isToday);
-        }
+        drawDateCell(painter, MonthGrid::numberText(cell.day), cell.rect, cell.epochDay,
+                     isSelected, isToday, isOtherMonth, isHovered);
     }
 }
 
@@ -490,30 +861,305 @@ void DateControl::drawYearView(QPainter &painter)
     int monthWidth = calendarRect.width() / monthCols;
     int monthHeight = calendarRect.height() / monthRows;
     
-    painter.setFont(QFont(font().family(), font().pointSize() - 2));
+    // 年份、尺寸或缩放比例变化时整体失效
+    int year = d->currentDate.year();
+    QSize monthSize(monthWidth, monthHeight);
+    qreal dpr = devicePixelRatioF();
+    if (year != d->yearCacheYear || monthSize != d->yearCacheMonthSize || dpr != d->yearCacheDpr) {
+        invalidateDateCaches();
+        d->yearCacheYear = year;
+        d->yearCacheMonthSize = monthSize;
+        d->yearCacheDpr = dpr;
+    }
+    
+    if (monthSize.isEmpty())
+        return;
     
     for (int month = 1; month <= 12; ++month) {
         int row = (month - 1) / monthCols;
         int col = (month - 1) % monthCols;
         
-        QRect monthRect(calendarRect.left() + col * monthWidth,
-                       calendarRect.top() + row * monthHeight,
-                       monthWidth, monthHeight);
-        
-        // 绘制月份标题
-        QString monthName = QLocale().monthName(month, QLocale::ShortFormat);
-        QRect titleRect = monthRect;
-        titleRect.setHeight(20);
-        
-        painter.setPen(d->headerColor);
-        painter.drawText(titleRect, Qt::AlignCenter, monthName);
+        QPixmap &cache = d->miniMonthCache[month - 1];
+        if (cache.isNull()) {
+            cache = renderMiniMonth(year, month, monthSize, dpr);
+        }
+        painter.drawPixmap(calendarRect.left() + col * monthWidth,
+                           calendarRect.top() + row * monthHeight, cache);
+    }
+}
+
+QPixmap DateControl::renderMiniMonth(int year, int month, const QSize &size, qreal dpr)
+{
+    QPixmap pixmap(size * dpr);
+    pixmap.setDevicePixelRatio(dpr);
+    pixmap.fill(Qt::transparent);
+    
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setFont(QFont(font().family(), font().pointSize() - 2));
+    
+    QRect monthRect(QPoint(0, 0), size);
+    
+    // 绘制月份标题
+    QString monthName = locale().monthName(month, QLocale::ShortFormat);
+    QRect titleRect = monthRect;
+    titleRect.setHeight(20);
+    
+    painter.setPen(d->headerColor);
+    painter.drawText(titleRect, Qt::AlignCenter, monthName);
+    
+    // 绘制简化的月份日历
+    QRect miniCalRect = monthRect.adjusted(5, 25, -5, -5);
+    drawMiniMonth(painter, year, month, miniCalRect);
+    
+    return pixmap;
+}
+
+void DateControl::invalidateDateCache(const QDate &date)
+{
+    if (date.isValid() && date.year() == d->yearCacheYear) {
+        d->miniMonthCache[date.month() - 1] = QPixmap();
+    }
+    
+    if (date.isValid()) {
+        qint64 week = weekOf(date);
+        for (Private::WeekRow &row : d->weekRows) {
+            if (row.week == week)
+                row.week = kNoWeek;
+        }
+    }
+}
+
+void DateControl::invalidateDateCaches()
+{
+    for (QPixmap &cache : d->miniMonthCache) {
+        cache = QPixmap();
+    }
+    
+    // 周行只标记失效，像素图留给后续复用
+    for (Private::WeekRow &row : d->weekRows) {
+        row.week = kNoWeek;
+    }
+}
+
+void DateControl::drawContinuousView(QPainter &painter)
+{
+    // 列宽、行高与月视图共用同一个网格模型
+    ensureMonthGrid();
+    const MonthGrid &grid = d->monthGrid;
+    d->cellWidth = grid.cellWidth();
+    d->cellHeight = grid.cellHeight();
+    
+    QFont weekFont = font();
+    weekFont.setBold(false);
+    weekFont.setPointSize(font().pointSize() - 1);
+    for (int i = 0; i < MonthGrid::kColumns; ++i) {
+        QColor weekColor = (i >= 5) ? d->weekendColor : d->textColor;
+        d->glyphAtlas.drawText(painter, grid.weekdayTitleRect(i), MonthGrid::weekdayTitle(i),
+                               weekFont, weekColor);
+    }
+    
+    QRect rowsRect = getWeekRowsRect();
+    int rowHeight = grid.cellHeight();
+    if (rowHeight <= 0 || rowsRect.isEmpty())
+        return;
+    
+    // 跨过午夜后缓存中的“今天”高亮已过期
+    qint64 today = CivilDate::epochDay(QDate::currentDate());
+    if (today != d->weekRowsToday) {
+        d->weekRowsToday = today;
+        invalidateDateCaches();
+    }
+    
+    // 只绘制与可见区域相交的周，每行直接拷贝缓存的像素图
+    qreal dpr = painter.device()->devicePixelRatioF();
+    QSize rowSize(rowsRect.width(), rowHeight);
+    qint64 week = qFloor(d->scrollWeeks);
+    int y = rowsRect.top() - qRound((d->scrollWeeks - week) * rowHeight);
+    qint64 lastWeek = weekCount() - 1;
+    
+    painter.save();
+    painter.setClipRect(rowsRect);
+    for (; y <= rowsRect.bottom() && week <= lastWeek; ++week, y += rowHeight) {
+        painter.drawPixmap(rowsRect.left(), y, weekRowPixmap(week, rowSize, dpr));
+    }
+    painter.restore();
+}
+
+const QPixmap &DateControl::weekRowPixmap(qint64 week, const QSize &size, qreal dpr)
+{
+    QSize pixelSize = size * dpr;
+    for (const Private::WeekRow &row : d->weekRows) {
+        if (row.week == week && row.pixmap.size() == pixelSize && row.pixmap.devicePixelRatio() == dpr)
+            return row.pixmap;
+    }
+    
+    // 优先复用已滚出可见区域（或已失效）的行，滚动时不再分配新的像素图
+    qint64 topWeek = qFloor(d->scrollWeeks);
+    qint64 bottomWeek = topWeek + qCeil(visibleWeekRows());
+    Private::WeekRow *slot = nullptr;
+    for (Private::WeekRow &row : d->weekRows) {
+        if (row.week == week || row.week < topWeek || row.week > bottomWeek) {
+            slot = &row;
+            break;
+        }
+    }
+    if (!slot) {
+        d->weekRows.append(Private::WeekRow{kNoWeek, QPixmap()});
+        slot = &d->weekRows.last();
+    }
+    
+    if (slot->pixmap.size() != pixelSize || slot->pixmap.devicePixelRatio() != dpr) {
+        slot->pixmap = QPixmap(pixelSize);
+        slot->pixmap.setDevicePixelRatio(dpr);
+    }
+    slot->week = week;
+    renderWeekRow(slot->pixmap, week);
+    return slot->pixmap;
+}
+
+void DateControl::renderWeekRow(QPixmap &pixmap, qint64 week)
+{
+    pixmap.fill(Qt::transparent);
+    
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    
+    const MonthGrid &grid = d->monthGrid;
+    int cellW = grid.cellWidth();
+    int rowHeight = qRound(pixmap.height() / pixmap.devicePixelRatio());
+    int columnLeft = grid.cell(0).rect.left() - getWeekRowsRect().left();
+    qint64 startDay = firstWeekDay() + week * 7;
+    
+    if (d->showWeekNumbers) {
+        d->glyphAtlas.drawText(painter, QRect(0, 0, cellW, rowHeight),
+                               MonthGrid::numberText(CivilDate::isoWeekNumber(startDay)),
+                               font(), d->textColor.lighter(150));
+    }
+    
+    qint64 minDay = CivilDate::epochDay(d->minDate);
+    qint64 maxDay = CivilDate::epochDay(d->maxDate);
+    qint64 today = d->weekRowsToday;
+    qint64 selectedDay = CivilDate::epochDay(d->selectedDate);
+    
+    for (int column = 0; column < MonthGrid::kColumns; ++column) {
+        qint64 day = startDay + column;
+        if (day < minDay || day > maxDay)
+            continue;
         
-        // 绘制简化的月份日历
-        QRect miniCalRect = monthRect.adjusted(5, 25, -5, -5);
-        drawMiniMonth(painter, d->currentDate.year(), month, miniCalRect);
+        // 单双月交替深浅区分月份，每月 1 日显示月份
+        CivilDate::YearMonthDay ymd = CivilDate::civilFromDays(day);
+        QString text = (ymd.day == 1) ? QString("%1月").arg(ymd.month) : MonthGrid::numberText(ymd.day);
+        QRect cellRect(columnLeft + column * cellW, 0, cellW, rowHeight);
+        drawDateCell(painter, text, cellRect, day, d->isDaySelected(day, selectedDay),
+                     day == today && d->showToday, ymd.month % 2 == 0);
     }
 }
 
+QRect DateControl::getWeekRowsRect() const
+{
+    // 第一行留给星期标题，宽度含周数列
+    ensureMonthGrid();
+    QRect calendarRect = getCalendarRect();
+    int rowHeight = d->monthGrid.cellHeight();
+    int right = d->monthGrid.cell(MonthGrid::kColumns - 1).rect.right();
+    return QRect(calendarRect.left(), calendarRect.top() + rowHeight,
+                 right - calendarRect.left() + 1, calendarRect.height() - rowHeight);
+}
+
+qint64 DateControl::firstWeekDay() const
+{
+    qint64 minDay = CivilDate::epochDay(d->minDate);
+    return minDay - (CivilDate::weekdayFromDays(minDay) - 1);
+}
+
+qint64 DateControl::weekCount() const
+{
+    return (CivilDate::epochDay(d->maxDate) - firstWeekDay()) / 7 + 1;
+}
+
+qint64 DateControl::weekOf(const QDate &date) const
+{
+    return (CivilDate::epochDay(date) - firstWeekDay()) / 7;
+}
+
+qreal DateControl::visibleWeekRows() const
+{
+    int rowHeight = d->monthGrid.cellHeight();
+    return rowHeight > 0 ? getWeekRowsRect().height() / qreal(rowHeight) : 0;
+}
+
+qreal DateControl::maxScrollWeeks() const
+{
+    return qMax(qreal(0), weekCount() - visibleWeekRows());
+}
+
+void DateControl::scrollToWeek(qreal week, bool animated)
+{
+    d->scrollVelocity = 0;
+    d->scrollTargetWeeks = qBound(qreal(0), week, maxScrollWeeks());
+    
+    if (!animated || !d->animationEnabled || !isVisible()) {
+        d->scrollWeeks = d->scrollTargetWeeks;
+        d->isScrolling = false;
+        syncMonthFromScroll();
+        update();
+        return;
+    }
+    
+    if (!d->isScrolling) {
+        d->isScrolling = true;
+        d->lastScrollFrameMs = FrameDriver::instance()->now();
+    }
+    ensureFrameSubscription();
+}
+
+void DateControl::advanceScroll(qint64 now)
+{
+    qreal dt = qMax<qint64>(0, now - d->lastScrollFrameMs) / 1000.0;
+    d->lastScrollFrameMs = now;
+    qreal maxWeeks = maxScrollWeeks();
+    
+    if (d->scrollVelocity != 0) {
+        // 惯性滚动：速度按指数衰减，碰到边界立即停止
+        d->scrollWeeks += d->scrollVelocity * dt;
+        d->scrollVelocity *= std::exp(-kFlingDecay * dt);
+        if (qAbs(d->scrollVelocity) < kMinFlingVelocity || d->scrollWeeks <= 0 || d->scrollWeeks >= maxWeeks)
+            d->scrollVelocity = 0;
+        d->scrollWeeks = qBound(qreal(0), d->scrollWeeks, maxWeeks);
+        d->scrollTargetWeeks = d->scrollWeeks;
+    } else {
+        // 平滑滚动：按经过的时间以固定比例逼近目标
+        d->scrollWeeks += (d->scrollTargetWeeks - d->scrollWeeks) * (1 - std::exp(-kScrollSmoothing * dt));
+        if (qAbs(d->scrollTargetWeeks - d->scrollWeeks) < 0.002)
+            d->scrollWeeks = d->scrollTargetWeeks;
+    }
+    
+    if (d->scrollVelocity == 0 && d->scrollWeeks == d->scrollTargetWeeks)
+        d->isScrolling = false;
+    
+    syncMonthFromScroll();
+    update(getCalendarRect());
+}
+
+void DateControl::syncMonthFromScroll()
+{
+    if (!d->scrollFollowsMonth || d->viewMode != ContinuousView)
+        return;
+    
+    // 以可见区域中间那一周的星期四所在月份为当前月份
+    qint64 middleWeek = qFloor(d->scrollWeeks + visibleWeekRows() / 2);
+    CivilDate::YearMonthDay ymd = CivilDate::civilFromDays(firstWeekDay() + middleWeek * 7 + 3);
+    if (ymd.year == d->currentDate.year() && ymd.month == d->currentDate.month())
+        return;
+    
+    int day = qMin(d->currentDate.day(), CivilDate::daysInMonth(ymd.year, ymd.month));
+    d->currentDate = QDate(ymd.year, ymd.month, day);
+    emit currentDateChanged(d->currentDate);
+    emit monthChanged(ymd.year, ymd.month);
+    update(getHeaderRect());
+}
+
 void DateControl::drawWeekView(QPainter &painter)
 {
     // 周视图：显示一周的详细信息
@@ -525,6 +1171,7 @@ void DateControl::drawWeekView(QPainter &painter)
     d->cellHeight = calendarRect.height();
     
     painter.setFont(font());
+    QDate today = QDate::currentDate();
     
     for (int day = 0; day < 7; ++day) {
         QDate date = startOfWeek.addDays(day);
@@ -533,24 +1180,32 @@ void DateControl::drawWeekView(QPainter &painter)
                       calendarRect.top(),
                       d->cellWidth, d->cellHeight);
         
-        bool isSelected = (date == d->selectedDate);
-        bool isToday = (date == QDate::currentDate() && d->showToday);
+        bool isSelected = d->isDaySelected(CivilDate::epochDay(date), CivilDate::epochDay(d->selectedDate));
+        bool isToday = (date == today && d->showToday);
+        bool isOtherMonth = date.month() != d->currentDate.month();
         
-        drawDateCell(painter, date, cellRect, isSelected, isToday);
+        drawDateCell(painter, MonthGrid::numberText(date.day()), cellRect, CivilDate::epochDay(date),
+                     isSelected, isToday, isOtherMonth);
     }
 }
 
 
 
-void DateControl::drawDateCell(QPainter &painter, const QDate &date, const QRect &rect, 
-                              bool isSelected, bool isToday)
+void DateControl::drawDateCell(QPainter &painter, const QString &dayText, const QRect &rect, qint64 epochDay,
+                               bool isSelected, bool isToday, bool isOtherMonth, bool isHovered)
 {
+    int heatLevel = d->heatmap.level(epochDay);
+    
     // 计算圆形区域，与图片样式一致
     int circleSize = qMin(rect.width(), rect.height()) - 6;
     QRect circleRect(rect.center().x() - circleSize/2, 
                     rect.center().y() - circleSize/2, 
                     circleSize, circleSize);
     
+    // 热度底色在最下层，圆点画在选中圆形之上
+    if (d->heatmapMode == HeatmapShading)
+        drawHeatMarker(painter, rect, heatLevel, false);
+    
     // 绘制选中状态的圆形背景 - 蓝色圆形
     if (isSelected) {
         // 绘制选中的蓝色圆形，与图片中的样式一致
@@ -564,16 +1219,25 @@ void DateControl::drawDateCell(QPainter &painter, const QDate &date, const QRect
         highlight.setColorAt(1, QColor(255, 255, 255, 0));
         painter.setBrush(QBrush(highlight));
         painter.drawEllipse(circleRect);
-    } else if (isToday) {
+    } else {
+        // 悬停的日期用浅色圆形提示
+        if (isHovered) {
+            painter.setBrush(QColor(255, 255, 255, 45));
+            painter.setPen(Qt::NoPen);
+            painter.drawEllipse(circleRect);
+        }
+        
         // 今天的日期用不同颜色标识
-        painter.setBrush(Qt::NoBrush);
-        painter.setPen(QPen(QColor(255, 255, 255, 150), 2));
-        painter.drawEllipse(circleRect);
+        if (isToday) {
+            painter.setBrush(Qt::NoBrush);
+            painter.setPen(QPen(QColor(255, 255, 255, 150), 2));
+            painter.drawEllipse(circleRect);
+        }
     }
     
     // 绘制日期文本
     QColor textColor = Qt::white;
-    if (date.month() != d->currentDate.month()) {
+    if (isOtherMonth) {
         textColor = QColor(255, 255, 255, 120); // 其他月份的日期显示为半透明
     }
     
@@ -581,45 +1245,133 @@ void DateControl::drawDateCell(QPainter &painter, const QDate &date, const QRect
         textColor = Qt::white;
     }
     
-    painter.setPen(textColor);
+    // 有农历标注时日号上移，给下方留出一行
+    bool annotated = rect.height() >= kMinAnnotatedCellHeight;
+    QRect numberRect = rect;
+    if (annotated && d->showLunar)
+        numberRect = QRect(rect.left(), rect.top() + rect.height() / 6, rect.width(), rect.height() / 2);
+    
     QFont dateFont = font();
     dateFont.setBold(isSelected);
     dateFont.setPointSize(font().pointSize() + (isSelected ? 1 : 0));
-    painter.setFont(dateFont);
-    painter.drawText(rect, Qt::AlignCenter, QString::number(date.day()));
+    d->glyphAtlas.drawText(painter, numberRect, dayText, dateFont, textColor);
+    
+    if (annotated)
+        drawDayAnnotation(painter, rect, epochDay, isSelected, isOtherMonth);
+    
+    if (d->heatmapMode == HeatmapDots)
+        drawHeatMarker(painter, circleRect, heatLevel, false);
+}
+
+void DateControl::drawDayAnnotation(QPainter &painter, const QRect &rect, qint64 epochDay,
+                                    bool isSelected, bool isOtherMonth)
+{
+    QFont smallFont = font();
+    smallFont.setBold(false);
+    smallFont.setPointSize(qMax(6, font().pointSize() - 3));
+    int alpha = isOtherMonth && !isSelected ? 110 : 210;
+    
+    // 右上角“休 / 班”
+    HolidayTable::DayKind kind = d->holidays.kind(epochDay);
+    if (kind != HolidayTable::NormalDay) {
+        int badgeSize = rect.height() / 3;
+        QRect badgeRect(rect.right() - badgeSize - 1, rect.top() + 2, badgeSize, badgeSize);
+        QColor badgeColor = (kind == HolidayTable::Holiday) ? QColor(255, 120, 120) : QColor(220, 220, 220);
+        badgeColor.setAlpha(alpha);
+        d->annotationAtlas.drawText(painter, badgeRect,
+                                    kind == HolidayTable::Holiday ? QStringLiteral("休") : QStringLiteral("班"),
+                                    smallFont, badgeColor);
+    }
+    
+    if (!d->showLunar)
+        return;
+    
+    // 优先级：节假日表中的名称 > 农历 / 公历节日 > 农历月份（初一）> 农历日
+    const QString *text = &d->holidays.name(epochDay);
+    bool isFestival = !text->isEmpty();
+    LunarCalendar::LunarDate lunar = LunarCalendar::fromEpochDay(epochDay);
+    if (!isFestival) {
+        CivilDate::YearMonthDay ymd = CivilDate::civilFromDays(epochDay);
+        text = &LunarCalendar::festivalName(lunar, ymd.month, ymd.day);
+        isFestival = !text->isEmpty();
+    }
+    if (!isFestival) {
+        if (lunar.month == 0)
+            return;
+        text = lunar.day == 1 ? &LunarCalendar::monthName(lunar.month, lunar.isLeapMonth)
+                              : &LunarCalendar::dayName(lunar.day);
+    }
+    
+    QColor color = isFestival ? QColor(255, 214, 102) : QColor(255, 255, 255);
+    color.setAlpha(alpha);
+    QRect lunarRect(rect.left(), rect.top() + rect.height() * 2 / 3 - 2, rect.width(), rect.height() / 4);
+    d->annotationAtlas.drawText(painter, lunarRect, *text, smallFont, color);
+}
+
+void DateControl::drawHeatMarker(QPainter &painter, const QRect &cellRect, int heatLevel, bool compact)
+{
+    if (heatLevel <= 0 || d->heatmapMode == NoHeatmap)
+        return;
+    
+    QColor color = d->heatmapColor;
+    painter.setPen(Qt::NoPen);
+    
+    if (d->heatmapMode == HeatmapShading) {
+        // 透明度随等级线性增加
+        color.setAlpha(40 + 150 * heatLevel / DayHeatmap::kMaxLevel);
+        painter.setBrush(color);
+        int inset = compact ? 1 : 3;
+        painter.drawRoundedRect(cellRect.adjusted(inset, inset, -inset, -inset), 3, 3);
+    } else {
+        // 圆点贴在单元格底部，半径随等级增大
+        qreal radius = compact ? 1.5 : 1.5 + 0.5 * heatLevel;
+        QPointF center(cellRect.center().x() + 0.5, cellRect.bottom() - radius - (compact ? 0 : 3));
+        painter.setBrush(color);
+        painter.drawEllipse(center, radius, radius);
+    }
 }
 
 void DateControl::drawMiniMonth(QPainter &painter, int year, int month, const QRect &rect)
 {
-    // 绘制年视图中的小月份日历
-    QDate firstDay(year, month, 1);
-    QDate startDate = firstDay.addDays(-(firstDay.dayOfWeek() - 1));
+    // 绘制年视图中的小月份日历，日期按纪元日整数推算
+    qint64 firstDay = CivilDate::daysFromCivil(year, month, 1);
+    qint64 startDay = firstDay - (CivilDate::weekdayFromDays(firstDay) - 1);
+    qint64 selectedDay = CivilDate::epochDay(d->selectedDate);
+    int monthDays = CivilDate::daysInMonth(year, month);
+    int prevMonthDays = CivilDate::daysInMonth(month == 1 ? year - 1 : year, month == 1 ? 12 : month - 1);
+    int leading = static_cast<int>(firstDay - startDay);
     
     int cellW = rect.width() / 7;
     int cellH = rect.height() / 6;
     
     for (int week = 0; week < 6; ++week) {
         for (int day = 0; day < 7; ++day) {
-            QDate date = startDate.addDays(week * 7 + day);
+            int offset = week * 7 + day - leading;
+            bool inMonth = offset >= 0 && offset < monthDays;
+            int dayNumber = offset < 0 ? prevMonthDays + offset + 1
+                                       : inMonth ? offset + 1 : offset - monthDays + 1;
             
             QRect cellRect(rect.left() + day * cellW,
                           rect.top() + week * cellH,
                           cellW, cellH);
             
             QColor textColor = d->textColor;
-            if (date.month() != month) {
+            if (!inMonth) {
                 textColor = textColor.lighter(200);
             }
             
-            if (date == d->selectedDate) {
+            qint64 cellDay = startDay + week * 7 + day;
+            drawHeatMarker(painter, cellRect, d->heatmap.level(cellDay), true);
+            
+            if (d->isDaySelected(cellDay, selectedDay)) {
                 painter.setBrush(d->selectedColor);
                 painter.setPen(Qt::NoPen);
                 painter.drawEllipse(cellRect.center(), 3, 3);
                 textColor = Qt::white;
             }
             
-            painter.setPen(textColor);
-            painter.drawText(cellRect, Qt::AlignCenter, QString::number(date.day()));
+            d->glyphAtlas.drawText(painter, cellRect, MonthGrid::numberText(dayNumber),
+                                   painter.font(), textColor);
         }
     }
 }
@@ -628,44 +1380,43 @@ void DateControl::drawMiniMonth(QPainter &painter, int year, int month, const QR
 
 QRect DateControl::getDateCellRect(const QDate &date) const
 {
-    if (d->viewMode != MonthView)
+    if (d->viewMode != MonthView || !date.isValid())
         return QRect();
     
-    QDate firstDay = QDate(d->currentDate.year(), d->currentDate.month(), 1);
-    QDate startDate = firstDay.addDays(-(firstDay.dayOfWeek() - 1));
-    
-    int daysDiff = startDate.daysTo(date);
-    int week = daysDiff / 7;
-    int day = daysDiff % 7;
-    
-    QRect calendarRect = getCalendarRect();
-    int startCol = d->showWeekNumbers ? 1 : 0;
-    
-    return QRect(calendarRect.left() + (startCol + day) * d->cellWidth,
-                calendarRect.top() + (week + 1) * d->cellHeight,
-                d->cellWidth, d->cellHeight);
+    ensureMonthGrid();
+    int index = d->monthGrid.indexOf(CivilDate::epochDay(date));
+    return index >= 0 ? d->monthGrid.cell(index).rect : QRect();
 }
 
 QDate DateControl::getDateAtPosition(const QPoint &pos) const
 {
-    if (d->viewMode != MonthView)
-        return QDate();
+    if (d->viewMode == ContinuousView) {
+        QRect rowsRect = getWeekRowsRect();
+        const MonthGrid &grid = d->monthGrid;
+        if (!rowsRect.contains(pos) || grid.cellWidth() <= 0 || grid.cellHeight() <= 0)
+            return QDate();
+        
+        int dx = pos.x() - grid.cell(0).rect.left();
+        int column = dx / grid.cellWidth();
+        if (dx < 0 || column >= MonthGrid::kColumns)
+            return QDate();
+        
+        qint64 week = qFloor(d->scrollWeeks + (pos.y() - rowsRect.top()) / qreal(grid.cellHeight()));
+        qint64 day = firstWeekDay() + week * 7 + column;
+        if (day < CivilDate::epochDay(d->minDate) || day > CivilDate::epochDay(d->maxDate))
+            return QDate();
+        return CivilDate::dateFromEpochDay(day);
+    }
     
-    QRect calendarRect = getCalendarRect();
-    if (!calendarRect.contains(pos))
+    if (d->viewMode != MonthView)
         return QDate();
     
-    int startCol = d->showWeekNumbers ? 1 : 0;
-    int col = (pos.x() - calendarRect.left()) / d->cellWidth - startCol;
-    int row = (pos.y() - calendarRect.top()) / d->cellHeight - 1; // 减去标题行
-    
-    if (col < 0 || col >= 7 || row < 0 || row >= 6)
+    ensureMonthGrid();
+    int index = d->monthGrid.indexAt(pos);
+    if (index < 0)
         return QDate();
     
-    QDate firstDay = QDate(d->currentDate.year(), d->currentDate.month(), 1);
-    QDate startDate = firstDay.addDays(-(firstDay.dayOfWeek() - 1));
-    
-    return startDate.addDays(row * 7 + col);
+    return CivilDate::dateFromEpochDay(d->monthGrid.cell(index).epochDay);
 }
 
 QRect DateControl::getHeaderRect() const
@@ -678,12 +1429,33 @@ QRect DateControl::getCalendarRect() const
     return QRect(10, d->headerHeight + 20, width() - 20, height() - d->headerHeight - 90);
 }
 
+QRect DateControl::getBottomRect() const
+{
+    return QRect(rect().left() + 15, rect().bottom() - 55, rect().width() - 30, 40);
+}
+
+void DateControl::updateDateCell(const QDate &date)
+{
+    // 单元格外扩 1 像素，覆盖抗锯齿边缘
+    QRect cellRect = getDateCellRect(date);
+    if (cellRect.isValid())
+        update(cellRect.adjusted(-1, -1, 1, 1));
+}
+
 void DateControl::calculateLayout()
 {
     d->calendarRect = getCalendarRect();
     d->headerRect = getHeaderRect();
 }
 
+void DateControl::ensureMonthGrid() const
+{
+    // 参数未变时 rebuild 直接返回；“今天”随系统日期变化，每次只取一次
+    d->monthGrid.rebuild(d->currentDate.year(), d->currentDate.month(),
+                         CivilDate::epochDay(QDate::currentDate()),
+                         getCalendarRect(), d->showWeekNumbers);
+}
+
 void DateControl::updateCalendar()
 {
     calculateLayout();
@@ -692,28 +1464,96 @@ void DateControl::updateCalendar()
 
 void DateControl::startTransitionAnimation()
 {
-    if (!d->animationEnabled)
+    if (!d->animationEnabled || d->outgoingSnapshot.isNull() || d->incomingSnapshot.isNull())
         return;
     
     d->isAnimating = true;
     d->animationProgress = 0.0;
-    d->animationTimer->start();
+    d->animationStartMs = FrameDriver::instance()->now();
+    ensureFrameSubscription();
+}
+
+void DateControl::ensureFrameSubscription()
+{
+    // 月份过渡和连续滚动共用同一个帧回调
+    if (!FrameDriver::instance()->isSubscribed(this))
+        FrameDriver::instance()->subscribe(this, [this](qint64) { onAnimationTimer(); });
 }
 
 void DateControl::onAnimationTimer()
 {
-    if (!d->isAnimating)
-        return;
+    qint64 now = FrameDriver::instance()->now();
     
-    d->animationProgress += 0.05; // 动画速度
+    if (d->isAnimating) {
+        // 按经过的时间计算进度，帧率变化不影响动画时长
+        qint64 elapsed = now - d->animationStartMs;
+        d->animationProgress = qMin(1.0, elapsed / double(kTransitionDurationMs));
+        
+        if (d->animationProgress >= 1.0) {
+            d->isAnimating = false;
+            d->outgoingSnapshot = QPixmap();
+            d->incomingSnapshot = QPixmap();
+        }
+        
+        // 头部和底部在切换时已经更新，动画帧只需重画日历区域
+        update(getCalendarRect());
+    }
+    
+    if (d->isScrolling)
+        advanceScroll(now);
+    
+    if (!d->isAnimating && !d->isScrolling)
+        FrameDriver::instance()->unsubscribe(this);
+}
+
+QPixmap DateControl::renderCalendarSnapshot()
+{
+    QRect calendarRect = getCalendarRect();
+    if (calendarRect.isEmpty())
+        return QPixmap();
+    
+    qreal dpr = devicePixelRatioF();
+    QPixmap snapshot(calendarRect.size() * dpr);
+    snapshot.setDevicePixelRatio(dpr);
+    snapshot.fill(Qt::transparent);
+    
+    QPainter painter(&snapshot);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.translate(-calendarRect.topLeft());
     
-    if (d->animationProgress >= 1.0) {
-        d->animationProgress = 1.0;
-        d->isAnimating = false;
-        d->animationTimer->stop();
+    switch (d->viewMode) {
+    case MonthView:
+        drawMonthView(painter, calendarRect);
+        break;
+    case YearView:
+        drawYearView(painter);
+        break;
+    case WeekView:
+        drawWeekView(painter);
+        break;
+    case ContinuousView:
+        drawContinuousView(painter);
+        break;
     }
     
-    update();
+    return snapshot;
+}
+
+void DateControl::drawTransition(QPainter &painter)
+{
+    QRect calendarRect = getCalendarRect();
+    
+    // 向后翻页时新内容从右侧滑入，向前翻页时从左侧滑入
+    int direction = d->animationEndDate > d->animationStartDate ? 1 : -1;
+    QEasingCurve easing(QEasingCurve::OutCubic);
+    int offset = qRound(easing.valueForProgress(d->animationProgress) * calendarRect.width());
+    
+    painter.save();
+    painter.setClipRect(calendarRect);
+    painter.drawPixmap(calendarRect.topLeft() - QPoint(direction * offset, 0), d->outgoingSnapshot);
+    painter.drawPixmap(calendarRect.topLeft() + QPoint(direction * (calendarRect.width() - offset), 0),
+                       d->incomingSnapshot);
+    painter.restore();
 }
 
 void DateControl::mousePressEvent(QMouseEvent *event)
@@ -735,30 +1575,131 @@ void DateControl::mousePressEvent(QMouseEvent *event)
             return;
         }
         
-        // 检查日期点击
-        QDate clickedDate = getDateAtPosition(event->pos());
-        if (clickedDate.isValid()) {
-            setSelectedDate(clickedDate);
-            emit dateClicked(clickedDate);
+        // 连续视图中按下时先开始拖动，松开时没有移动才算点击
+        if (d->viewMode == ContinuousView && getWeekRowsRect().contains(event->pos())) {
+            d->isDragging = true;
+            d->dragMoved = false;
+            d->dragStartPos = event->pos();
+            d->dragStartWeeks = d->scrollWeeks;
+            d->lastMousePos = event->pos();
+            d->lastDragMs = FrameDriver::instance()->now();
+            d->scrollVelocity = 0;
+            d->isScrolling = false;
+            return;
         }
+        
+        // 检查日期点击
+        clickDate(getDateAtPosition(event->pos()), event->modifiers());
     }
     
     QWidget::mousePressEvent(event);
 }
 
+void DateControl::updateMultiSelection(const QDate &date, Qt::KeyboardModifiers modifiers)
+{
+    if ((modifiers & Qt::ShiftModifier) && d->selectionAnchor.isValid()) {
+        // Shift：从起点到点击日期整段选中，Ctrl 同时按下时保留原有选择
+        if (!(modifiers & Qt::ControlModifier))
+            d->selection.clear();
+        selectDateRange(d->selectionAnchor, date);
+        return;
+    }
+    
+    d->selectionAnchor = date;
+    if (modifiers & Qt::ControlModifier) {
+        setDateSelected(date, !isDateSelected(date));
+    } else {
+        d->selection.clear();
+        d->selection.set(CivilDate::epochDay(date));
+        invalidateDateCaches();
+        update();
+        emit selectionChanged();
+    }
+}
+
+void DateControl::clickDate(const QDate &date, Qt::KeyboardModifiers modifiers)
+{
+    if (!date.isValid())
+        return;
+    
+    if (d->selectionMode == MultiSelection)
+        updateMultiSelection(date, modifiers);
+    setSelectedDate(date);
+    emit dateClicked(date);
+}
+
 void DateControl::mouseMoveEvent(QMouseEvent *event)
 {
+    if (d->isDragging) {
+        if (!d->dragMoved
+            && (event->pos() - d->dragStartPos).manhattanLength() >= QApplication::startDragDistance()) {
+            d->dragMoved = true;
+        }
+        
+        int rowHeight = d->monthGrid.cellHeight();
+        if (d->dragMoved && rowHeight > 0) {
+            // 估计拖动速度（周/秒），松手后按此速度惯性滚动
+            qint64 now = FrameDriver::instance()->now();
+            qint64 dt = now - d->lastDragMs;
+            if (dt > 0) {
+                qreal velocity = -(event->pos().y() - d->lastMousePos.y()) / qreal(rowHeight) * 1000.0 / dt;
+                d->scrollVelocity = 0.8 * velocity + 0.2 * d->scrollVelocity;
+            }
+            d->lastMousePos = event->pos();
+            d->lastDragMs = now;
+            
+            qreal weeks = d->dragStartWeeks - (event->pos().y() - d->dragStartPos.y()) / qreal(rowHeight);
+            d->scrollWeeks = qBound(qreal(0), weeks, maxScrollWeeks());
+            d->scrollTargetWeeks = d->scrollWeeks;
+            d->scrollFollowsMonth = true;
+            syncMonthFromScroll();
+            update(getCalendarRect());
+        }
+        return;
+    }
+    
     QDate hoveredDate = getDateAtPosition(event->pos());
     if (hoveredDate != d->hoveredDate) {
+        // 只重画离开和进入的两个单元格
+        QDate previous = d->hoveredDate;
         d->hoveredDate = hoveredDate;
-        update();
+        updateDateCell(previous);
+        updateDateCell(hoveredDate);
     }
     
     QWidget::mouseMoveEvent(event);
 }
 
+void DateControl::leaveEvent(QEvent *event)
+{
+    if (d->hoveredDate.isValid()) {
+        QDate previous = d->hoveredDate;
+        d->hoveredDate = QDate();
+        updateDateCell(previous);
+    }
+    
+    QWidget::leaveEvent(event);
+}
+
 void DateControl::mouseReleaseEvent(QMouseEvent *event)
 {
+    if (d->isDragging && event->button() == Qt::LeftButton) {
+        d->isDragging = false;
+        
+        if (!d->dragMoved) {
+            clickDate(getDateAtPosition(event->pos()), event->modifiers());
+        } else if (qAbs(d->scrollVelocity) >= kMinFlingVelocity
+                   && FrameDriver::instance()->now() - d->lastDragMs < 100) {
+            // 松手前仍在移动时进入惯性滚动
+            d->isScrolling = true;
+            d->lastScrollFrameMs = FrameDriver::instance()->now();
+            ensureFrameSubscription();
+        } else {
+            d->scrollVelocity = 0;
+        }
+        return;
+    }
+    
     QWidget::mouseReleaseEvent(event);
 }
 
@@ -776,6 +1717,19 @@ void DateControl::mouseDoubleClickEvent(QMouseEvent *event)
 
 void DateControl::wheelEvent(QWheelEvent *event)
 {
+    // 连续视图：触控板按像素直接滚动，滚轮按格平滑滚动，连续滚动时目标累加
+    if (d->viewMode == ContinuousView) {
+        d->scrollFollowsMonth = true;
+        int rowHeight = d->monthGrid.cellHeight();
+        if (!event->pixelDelta().isNull() && rowHeight > 0) {
+            scrollToWeek(d->scrollWeeks - event->pixelDelta().y() / qreal(rowHeight), false);
+        } else {
+            scrollToWeek(d->scrollTargetWeeks - event->angleDelta().y() / 120.0 * kWheelStepWeeks, true);
+        }
+        event->accept();
+        return;
+    }
+    
     QPoint numDegrees = event->angleDelta() / 8;
     
     if (!numDegrees.isNull()) {
@@ -798,7 +1752,7 @@ void DateControl::resizeEvent(QResizeEvent *event)
 void DateControl::drawBottomDateDisplay(QPainter &painter)
 {
     // 绘制底部日期显示区域，与图片样式完全一致
-    QRect bottomRect(rect().left() + 15, rect().bottom() - 55, rect().width() - 30, 40);
+    QRect bottomRect = getBottomRect();
     
     // 绘制日历图标 - 更精致的设计
     QRect iconRect(bottomRect.left() + 12, bottomRect.center().y() - 10, 20, 20);
@@ -831,6 +1785,19 @@ void DateControl::drawBottomDateDisplay(QPainter &painter)
     painter.drawText(textRect, Qt::AlignLeft | Qt::AlignVCenter, dateText);
 }
 
+void DateControl::changeEvent(QEvent *event)
+{
+    // 字体、样式或语言变化后，缓存的小月历和字形图集需要重画
+    if (event->type() == QEvent::FontChange || event->type() == QEvent::StyleChange
+        || event->type() == QEvent::LocaleChange) {
+        invalidateDateCaches();
+        d->glyphAtlas.clear();
+        d->annotationAtlas.clear();
+        d->backgroundCache = QPixmap();
+    }
+    QWidget::changeEvent(event);
+}
+
 void DateControl::keyPressEvent(QKeyEvent *event)
 {
     switch (event->key()) {
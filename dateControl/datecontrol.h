@@ -8,13 +8,13 @@
 #include <QPair>
 #include <QVariant>
 #include <QColor>
+#include <QPixmap>
 
 class QMouseEvent;
 class QWheelEvent;
 class QPaintEvent;
 class QResizeEvent;
 class QPainter;
-class QTimer;
 
 /**
  * @brief 日期控制插件类
@@ -32,7 +32,25 @@ public:
     enum ViewMode {
         MonthView,    // 月视图
         YearView,     // 年视图
-        WeekView      // 周视图
+        WeekView,     // 周视图
+        ContinuousView // 连续滚动视图，按周纵向滚动整个日期范围
+    };
+    
+    /**
+     * @brief 日期选择模式
+     */
+    enum SelectionMode {
+        SingleSelection,  // 只选中一天
+        MultiSelection    // 点击单选，Ctrl 点击增减，Shift 点击选中区间
+    };
+    
+    /**
+     * @brief 每日记录的显示方式
+     */
+    enum HeatmapMode {
+        NoHeatmap,        // 不显示
+        HeatmapDots,      // 日期下方的圆点，大小随热度变化
+        HeatmapShading    // 单元格底色，深浅随热度变化
     };
 
 public:
@@ -46,6 +64,16 @@ public:
     void setSelectedDate(const QDate &date);
     QDate selectedDate() const;
     
+    // 多选，覆盖 minDate～maxDate；MultiSelection 模式下按集合显示选中
+    void setSelectionMode(SelectionMode mode);
+    SelectionMode selectionMode() const;
+    void setDateSelected(const QDate &date, bool selected = true);
+    void selectDateRange(const QDate &from, const QDate &to, bool selected = true);
+    void clearSelection();
+    bool isDateSelected(const QDate &date) const;
+    int selectedDateCount() const;
+    QVector<QPair<QDate, QDate>> selectedRanges() const;
+    
     // 视图模式
     void setViewMode(ViewMode mode);
     ViewMode viewMode() const;
@@ -72,6 +100,12 @@ public:
     void setShowToday(bool show);
     bool isShowToday() const;
     
+    // 农历与节假日：日号下方显示农历日或节日，右上角标注“休 / 班”
+    void setShowLunar(bool show);
+    bool isShowLunar() const;
+    bool loadHolidayFile(const QString &fileName, QString *errorMessage = nullptr);
+    void clearHolidays();
+    
     // 导航控制
     void goToToday();
     void goToNextMonth();
@@ -82,11 +116,22 @@ public:
     // 动画效果
     void setAnimationEnabled(bool enabled);
     bool isAnimationEnabled() const;
+    
+    // 每日记录热度，覆盖 minDate～maxDate
+    void setDayCounts(const QDate &firstDate, const QVector<int> &counts);
+    void setEventTimestamps(const QVector<qint64> &sortedMSecsSinceEpoch);
+    void clearDayCounts();
+    int dayCount(const QDate &date) const;
+    
+    void setHeatmapMode(HeatmapMode mode);
+    HeatmapMode heatmapMode() const;
+    void setHeatmapColor(const QColor &color);
 
 signals:
     void dateClicked(const QDate &date);
     void dateDoubleClicked(const QDate &date);
     void dateSelectionChanged(const QDate &date);
+    void selectionChanged();
     void currentDateChanged(const QDate &date);
     void viewModeChanged(ViewMode mode);
     void monthChanged(int year, int month);
@@ -100,6 +145,8 @@ protected:
     void wheelEvent(QWheelEvent *event) override;
     void resizeEvent(QResizeEvent *event) override;
     void keyPressEvent(QKeyEvent *event) override;
+    void changeEvent(QEvent *event) override;
+    void leaveEvent(QEvent *event) override;
 
 private slots:
     void onAnimationTimer();
@@ -108,10 +155,14 @@ private:
     // 绘制函数
     void drawBackground(QPainter &painter);
     void drawHeader(QPainter &painter);
-    void drawMonthView(QPainter &painter);
+    void drawMonthView(QPainter &painter, const QRect &dirtyRect);
     void drawYearView(QPainter &painter);
     void drawWeekView(QPainter &painter);
-    void drawDateCell(QPainter &painter, const QDate &date, const QRect &rect, bool isSelected, bool isToday);
+    void drawDateCell(QPainter &painter, const QString &dayText, const QRect &rect, qint64 epochDay,
+                      bool isSelected, bool isToday, bool isOtherMonth, bool isHovered = false);
+    void drawDayAnnotation(QPainter &painter, const QRect &rect, qint64 epochDay,
+                           bool isSelected, bool isOtherMonth);
+    void drawHeatMarker(QPainter &painter, const QRect &cellRect, int heatLevel, bool compact);
     void drawBottomDateDisplay(QPainter &painter);
     
     // 辅助函数
@@ -119,14 +170,40 @@ private:
     QDate getDateAtPosition(const QPoint &pos) const;
     QRect getHeaderRect() const;
     QRect getCalendarRect() const;
+    QRect getBottomRect() const;
+    void updateDateCell(const QDate &date);
+    void updateMultiSelection(const QDate &date, Qt::KeyboardModifiers modifiers);
+    void clickDate(const QDate &date, Qt::KeyboardModifiers modifiers);
     void drawMiniMonth(QPainter &painter, int year, int month, const QRect &rect);
+    QPixmap renderMiniMonth(int year, int month, const QSize &size, qreal dpr);
+    void invalidateDateCache(const QDate &date);
+    void invalidateDateCaches();
+    
+    // 连续滚动视图
+    void drawContinuousView(QPainter &painter);
+    const QPixmap &weekRowPixmap(qint64 week, const QSize &size, qreal dpr);
+    void renderWeekRow(QPixmap &pixmap, qint64 week);
+    QRect getWeekRowsRect() const;
+    qint64 firstWeekDay() const;
+    qint64 weekCount() const;
+    qint64 weekOf(const QDate &date) const;
+    qreal visibleWeekRows() const;
+    qreal maxScrollWeeks() const;
+    void scrollToWeek(qreal week, bool animated);
+    void advanceScroll(qint64 now);
+    void syncMonthFromScroll();
+    void ensureBackgroundCache();
     
     // 布局计算
     void calculateLayout();
+    void ensureMonthGrid() const;
     void updateCalendar();
     
     // 动画相关
     void startTransitionAnimation();
+    void ensureFrameSubscription();
+    QPixmap renderCalendarSnapshot();
+    void drawTransition(QPainter &painter);
 
 private:
     class Private;
@@ -1,23 +1,152 @@
 #include "datepicker.h"
+#include "framedriver.h"
 #include <QPainter>
 #include <QMouseEvent>
 #include <QApplication>
 #include <QDesktopWidget>
-#include <QPropertyAnimation>
-#include <QGraphicsOpacityEffect>
 #include <QTimer>
+#include <QPointer>
 #include <QDebug>
 
+namespace {
+
+/**
+ * @brief 弹出窗口外框
+ * 
+ * 淡入淡出期间隐藏真实日历，每帧只以当前不透明度贴一次快照，
+ * 不再像 QGraphicsOpacityEffect 那样每帧把整个日历离屏重绘再混合
+ */
+class PopupFrame : public QWidget
+{
+public:
+    PopupFrame()
+        : QWidget(nullptr, Qt::Popup | Qt::FramelessWindowHint)
+        , calendar(nullptr)
+        , snapshotOpacity(1.0)
+    {
+    }
+    
+    // 日历状态与快照一致时直接复用，否则重新渲染
+    void ensureSnapshot()
+    {
+        if (snapshot.isNull()
+            || snapshot.devicePixelRatioF() != calendar->devicePixelRatioF()
+            || snapshotSelected != calendar->selectedDate()
+            || snapshotCurrent != calendar->currentDate()
+            || snapshotToday != QDate::currentDate()) {
+            renderSnapshot();
+        }
+    }
+    
+    void renderSnapshot()
+    {
+        // 隐藏状态下也可渲染，同时预热日历内部的各级缓存
+        snapshot = calendar->grab();
+        snapshotSelected = calendar->selectedDate();
+        snapshotCurrent = calendar->currentDate();
+        snapshotToday = QDate::currentDate();
+    }
+    
+    // 切到快照合成；refresh 为 true 时按日历当前画面重新截取
+    void showSnapshot(bool refresh)
+    {
+        if (refresh)
+            renderSnapshot();
+        else
+            ensureSnapshot();
+        calendar->hide();
+        update();
+    }
+    
+    // 换回真实日历，快照保留给下次淡入淡出
+    void showLive()
+    {
+        calendar->show();
+        update();
+    }
+    
+    void setSnapshotOpacity(qreal opacity)
+    {
+        snapshotOpacity = opacity;
+        if (!calendar->isVisible())
+            update(calendar->geometry());
+    }
+    
+    DateControl *calendar;
+    QPixmap snapshot;
+    qreal snapshotOpacity;
+    
+protected:
+    void paintEvent(QPaintEvent *) override
+    {
+        if (calendar->isVisible() || snapshot.isNull())
+            return;
+        
+        QPainter painter(this);
+        painter.setOpacity(snapshotOpacity);
+        painter.drawPixmap(calendar->pos(), snapshot);
+    }
+    
+private:
+    QDate snapshotSelected;
+    QDate snapshotCurrent;
+    QDate snapshotToday;
+};
+
+// 所有选择器共用的弹出日历，第一次用到时创建，应用退出前销毁
+struct SharedPopup {
+    QPointer<PopupFrame> popup;
+    QPointer<DateControl> calendar;
+    QPointer<DatePicker> owner;     // 当前占用弹出窗口的选择器
+};
+
+SharedPopup &sharedPopup()
+{
+    static SharedPopup shared;
+    return shared;
+}
+
+SharedPopup &ensureSharedPopup()
+{
+    SharedPopup &shared = sharedPopup();
+    
+    if (!shared.popup) {
+        // 创建日历弹出窗口 - 半透明背景
+        shared.popup = new PopupFrame;
+        shared.popup->setAttribute(Qt::WA_TranslucentBackground);
+        shared.popup->setFixedSize(420, 550);
+        shared.popup->setWindowOpacity(0.95);
+        shared.popup->hide();
+        
+        // 在弹出窗口中创建日历控件
+        shared.calendar = new DateControl(shared.popup);
+        shared.calendar->setGeometry(10, 10, 400, 530);
+        shared.popup->calendar = shared.calendar;
+        
+        // 提前创建原生窗口，首次显示时不必再等平台建窗
+        shared.popup->create();
+        
+        // 顶层窗口没有父对象，需在 QApplication 析构前删除
+        QObject::connect(qApp, &QCoreApplication::aboutToQuit, shared.popup.data(), [] {
+            delete sharedPopup().popup;
+        });
+    }
+    
+    return shared;
+}
+
+} // namespace
+
 DatePicker::DatePicker(QWidget *parent)
     : QWidget(parent)
     , m_dateButton(nullptr)
-    , m_calendarPopup(nullptr)
-    , m_calendar(nullptr)
     , m_mainLayout(nullptr)
     , m_selectedDate(QDate::currentDate())
     , m_calendarVisible(false)
-    , m_showAnimation(nullptr)
-    , m_hideAnimation(nullptr)
+    , m_fadeFrom(0.0)
+    , m_fadeTo(0.0)
+    , m_fadeStartMs(0)
+    , m_fadeDurationMs(0)
 {
     setupUI();
     updateButtonText();
@@ -25,8 +154,12 @@ DatePicker::DatePicker(QWidget *parent)
 
 DatePicker::~DatePicker()
 {
-    if (m_calendarPopup) {
-        m_calendarPopup->deleteLater();
+    // 共用弹出窗口不随选择器销毁，只归还并隐藏
+    if (ownsPopup()) {
+        QWidget *popup = sharedPopup().popup;
+        releasePopup();
+        if (popup)
+            popup->hide();
     }
 }
 
@@ -64,42 +197,6 @@ void DatePicker::setupUI()
     
     connect(m_dateButton, &QPushButton::clicked, this, &DatePicker::onButtonClicked);
     m_mainLayout->addWidget(m_dateButton);
-    
-    // 创建日历弹出窗口 - 半透明背景
-    m_calendarPopup = new QWidget(nullptr, Qt::Popup | Qt::FramelessWindowHint);
-    m_calendarPopup->setAttribute(Qt::WA_TranslucentBackground);
-    m_calendarPopup->setFixedSize(420, 550);
-    m_calendarPopup->setWindowOpacity(0.95);
-    m_calendarPopup->hide();
-    
-    // 在弹出窗口中创建日历控件
-    m_calendar = new DateControl(m_calendarPopup);
-    m_calendar->setGeometry(10, 10, 400, 530);
-    m_calendar->setSelectedDate(m_selectedDate);
-    
-    // 连接日历信号
-    connect(m_calendar, &DateControl::dateClicked, this, &DatePicker::onDateClicked);
-    connect(m_calendar, &DateControl::dateSelectionChanged, this, &DatePicker::onDateSelectionChanged);
-    
-    // 安装事件过滤器以处理点击外部关闭
-    m_calendarPopup->installEventFilter(this);
-    qApp->installEventFilter(this);
-    
-    // 创建动画效果
-    QGraphicsOpacityEffect *effect = new QGraphicsOpacityEffect(m_calendarPopup);
-    m_calendarPopup->setGraphicsEffect(effect);
-    
-    m_showAnimation = new QPropertyAnimation(effect, "opacity", this);
-    m_showAnimation->setDuration(200);
-    m_showAnimation->setStartValue(0.0);
-    m_showAnimation->setEndValue(1.0);
-    
-    m_hideAnimation = new QPropertyAnimation(effect, "opacity", this);
-    m_hideAnimation->setDuration(150);
-    m_hideAnimation->setStartValue(1.0);
-    m_hideAnimation->setEndValue(0.0);
-    
-    connect(m_hideAnimation, &QPropertyAnimation::finished, m_calendarPopup, &QWidget::hide);
 }
 
 void DatePicker::setSelectedDate(const QDate &date)
@@ -108,9 +205,10 @@ void DatePicker::setSelectedDate(const QDate &date)
         return;
         
     m_selectedDate = date;
-    if (m_calendar) {
-        m_calendar->setSelectedDate(date);
-        m_calendar->setCurrentDate(date);
+    if (ownsPopup()) {
+        DateControl *calendar = sharedPopup().calendar;
+        calendar->setSelectedDate(date);
+        calendar->setCurrentDate(date);
     }
     updateButtonText();
     emit dateChanged(date);
@@ -146,29 +244,96 @@ void DatePicker::showCalendar()
 {
     if (m_calendarVisible)
         return;
+    
+    attachPopup();
+    SharedPopup &shared = sharedPopup();
+    
+    // 先用快照淡入，淡入结束后再换回真实日历；淡出途中重新打开时从当前不透明度继续
+    bool wasShown = shared.popup->isVisible();
+    shared.popup->showSnapshot(false);
+    if (!wasShown)
+        shared.popup->setSnapshotOpacity(0.0);
         
     // 计算弹出位置
     QPoint popupPos = calculatePopupPosition();
-    m_calendarPopup->move(popupPos);
+    shared.popup->move(popupPos);
     
     // 显示弹出窗口
-    m_calendarPopup->show();
-    m_calendarPopup->raise();
-    m_calendarPopup->activateWindow();
+    shared.popup->show();
+    shared.popup->raise();
+    shared.popup->activateWindow();
     
     // 播放显示动画
-    m_showAnimation->start();
+    startFade(1.0, 200);
     
     m_calendarVisible = true;
 }
 
+void DatePicker::preparePopup()
+{
+    SharedPopup &shared = ensureSharedPopup();
+    
+    // 弹出窗口正被占用（显示或淡出中）时不动它
+    if (shared.owner)
+        return;
+    
+    // 空闲时日历信号没有连接，同步日期不会触发任何选择器的回调
+    shared.calendar->setSelectedDate(m_selectedDate);
+    shared.calendar->setCurrentDate(m_selectedDate);
+    shared.popup->ensureSnapshot();
+}
+
+void DatePicker::attachPopup()
+{
+    SharedPopup &shared = ensureSharedPopup();
+    
+    // 淡出尚未结束时重新打开，仍由本选择器占用，无需重新同步
+    if (shared.owner != this) {
+        // 其他选择器正在使用（包括淡出中）时，先让它归还
+        if (shared.owner)
+            shared.owner->releasePopup();
+        shared.owner = this;
+        
+        // 先同步日期再连接信号，避免同步本身触发本选择器的回调
+        shared.calendar->setSelectedDate(m_selectedDate);
+        shared.calendar->setCurrentDate(m_selectedDate);
+        m_clickedConnection = connect(shared.calendar, &DateControl::dateClicked,
+                                      this, &DatePicker::onDateClicked);
+        m_selectionConnection = connect(shared.calendar, &DateControl::dateSelectionChanged,
+                                        this, &DatePicker::onDateSelectionChanged);
+    }
+    
+    // 事件过滤器只在弹出期间安装，空闲的选择器不经手任何事件
+    qApp->installEventFilter(this);
+}
+
+void DatePicker::releasePopup()
+{
+    if (!ownsPopup())
+        return;
+    
+    qApp->removeEventFilter(this);
+    disconnect(m_clickedConnection);
+    disconnect(m_selectionConnection);
+    FrameDriver::instance()->unsubscribe(this);
+    m_calendarVisible = false;
+    sharedPopup().owner = nullptr;
+}
+
+bool DatePicker::ownsPopup() const
+{
+    return sharedPopup().owner.data() == this;
+}
+
 void DatePicker::hideCalendar()
 {
     if (!m_calendarVisible)
         return;
         
-    // 播放隐藏动画
-    m_hideAnimation->start();
+    // 截取日历当前画面淡出，结束后隐藏弹出窗口并归还
+    qApp->removeEventFilter(this);
+    sharedPopup().popup->showSnapshot(true);
+    startFade(0.0, 150);
     
     m_calendarVisible = false;
 }
@@ -178,7 +343,7 @@ QPoint DatePicker::calculatePopupPosition()
     // 获取按钮在屏幕上的位置
     QPoint buttonPos = m_dateButton->mapToGlobal(QPoint(0, 0));
     QSize buttonSize = m_dateButton->size();
-    QSize popupSize = m_calendarPopup->size();
+    QSize popupSize = sharedPopup().popup->size();
     
     // 默认在按钮下方显示
     QPoint popupPos(buttonPos.x(), buttonPos.y() + buttonSize.height() + 5);
@@ -209,6 +374,33 @@ QPoint DatePicker::calculatePopupPosition()
     return popupPos;
 }
 
+void DatePicker::startFade(double targetOpacity, int durationMs)
+{
+    // 从当前不透明度开始，动画中途反向时不会跳变
+    m_fadeFrom = sharedPopup().popup->snapshotOpacity;
+    m_fadeTo = targetOpacity;
+    m_fadeStartMs = FrameDriver::instance()->now();
+    m_fadeDurationMs = durationMs;
+    FrameDriver::instance()->subscribe(this, [this](qint64 frameTimeMs) { onFadeFrame(frameTimeMs); });
+}
+
+void DatePicker::onFadeFrame(qint64 frameTimeMs)
+{
+    SharedPopup &shared = sharedPopup();
+    double progress = qBound(0.0, (frameTimeMs - m_fadeStartMs) / double(m_fadeDurationMs), 1.0);
+    shared.popup->setSnapshotOpacity(m_fadeFrom + (m_fadeTo - m_fadeFrom) * progress);
+    
+    if (progress >= 1.0) {
+        FrameDriver::instance()->unsubscribe(this);
+        if (m_calendarVisible) {
+            shared.popup->showLive();
+        } else {
+            releasePopup();
+            shared.popup->hide();
+        }
+    }
+}
+
 void DatePicker::onDateClicked(const QDate &date)
 {
     setSelectedDate(date);
@@ -236,12 +428,21 @@ void DatePicker::updateButtonText()
 
 bool DatePicker::eventFilter(QObject *obj, QEvent *event)
 {
+    // 只在本选择器占用弹出窗口期间安装
+    QWidget *popup = sharedPopup().popup;
+    
+    // Qt::Popup 点击外部时会自行隐藏，同步状态并归还
+    if (obj == popup && event->type() == QEvent::Hide && m_calendarVisible) {
+        releasePopup();
+        return QWidget::eventFilter(obj, event);
+    }
+    
     if (event->type() == QEvent::MouseButtonPress) {
         QMouseEvent *mouseEvent = static_cast<QMouseEvent*>(event);
         
         // 如果点击在弹出窗口外部，关闭日历
-        if (m_calendarVisible && obj != m_calendarPopup && 
-            !m_calendarPopup->geometry().contains(mouseEvent->globalPos())) {
+        if (m_calendarVisible && obj != popup && 
+            !popup->geometry().contains(mouseEvent->globalPos())) {
             
             // 检查是否点击在按钮上
             QPoint buttonPos = m_dateButton->mapToGlobal(QPoint(0, 0));
@@ -261,4 +462,11 @@ void DatePicker::paintEvent(QPaintEvent *event)
     Q_UNUSED(event);
     // 基类绘制
     QWidget::paintEvent(event);
+}
+
+void DatePicker::enterEvent(QEvent *event)
+{
+    // 鼠标移入到点击之间通常有上百毫秒，借这段时间建好窗口和快照
+    preparePopup();
+    QWidget::enterEvent(event);
 }
\ No newline at end of file
@@ -8,10 +8,12 @@
 #include <QLabel>
 #include "datecontrol.h"
 
-class QPropertyAnimation;
-
 /**
  * @brief 日期选择器控件 - 气泡弹出式日历
+ * 
+ * 弹出窗口和其中的日历在第一次打开时才创建，并由所有选择器共用；
+ * 全局事件过滤器只在弹出期间安装。鼠标移入按钮时预先创建窗口并渲染日历快照，
+ * 淡入淡出只合成这张快照，结束后再换回真实日历
  */
 class DatePicker : public QWidget
 {
@@ -35,6 +37,7 @@ signals:
 
 protected:
     void paintEvent(QPaintEvent *event) override;
+    void enterEvent(QEvent *event) override;
     bool eventFilter(QObject *obj, QEvent *event) override;
 
 private slots:
@@ -48,18 +51,31 @@ private:
     void showCalendar();
     void updateButtonText();
     QPoint calculatePopupPosition();
+    void startFade(double targetOpacity, int durationMs);
+    void onFadeFrame(qint64 frameTimeMs);
+    
+    // 共用弹出窗口的占用与归还
+    void preparePopup();
+    void attachPopup();
+    void releasePopup();
+    bool ownsPopup() const;
     
 private:
     QPushButton *m_dateButton;
-    QWidget *m_calendarPopup;
-    DateControl *m_calendar;
     QVBoxLayout *m_mainLayout;
     
     QDate m_selectedDate;
     bool m_calendarVisible;
     
-    QPropertyAnimation *m_showAnimation;
-    QPropertyAnimation *m_hideAnimation;
+    // 占用共用日历期间的信号连接
+    QMetaObject::Connection m_clickedConnection;
+    QMetaObject::Connection m_selectionConnection;
+    
+    // 淡入淡出由全局帧驱动推进
+    double m_fadeFrom;
+    double m_fadeTo;
+    qint64 m_fadeStartMs;
+    int m_fadeDurationMs;
 };
 
 #endif // DATEPICKER_H
\ No newline at end of file
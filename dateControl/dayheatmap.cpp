@@ -0,0 +1,134 @@
+#include "dayheatmap.h"
+#include "civildate.h"
+#include <QDateTime>
+#include <limits>
+
+namespace {
+
+const int kMaxStoredCount = std::numeric_limits<quint16>::max();
+
+} // namespace
+
+DayHeatmap::DayHeatmap()
+    : m_firstDay(0)
+    , m_maxCount(0)
+{
+}
+
+void DayHeatmap::setRange(qint64 firstEpochDay, qint64 lastEpochDay)
+{
+    if (lastEpochDay < firstEpochDay)
+        return;
+    
+    int size = static_cast<int>(lastEpochDay - firstEpochDay + 1);
+    if (firstEpochDay == m_firstDay && size == m_counts.size())
+        return;
+    
+    QVector<quint16> counts(size, 0);
+    qint64 overlapFirst = qMax(firstEpochDay, m_firstDay);
+    qint64 overlapLast = qMin(lastEpochDay, m_firstDay + m_counts.size() - 1);
+    for (qint64 day = overlapFirst; day <= overlapLast; ++day)
+        counts[int(day - firstEpochDay)] = m_counts.at(int(day - m_firstDay));
+    
+    m_firstDay = firstEpochDay;
+    m_counts.swap(counts);
+    updateMaxCount();
+}
+
+qint64 DayHeatmap::firstDay() const
+{
+    return m_firstDay;
+}
+
+qint64 DayHeatmap::lastDay() const
+{
+    return m_firstDay + m_counts.size() - 1;
+}
+
+void DayHeatmap::setCounts(qint64 firstEpochDay, const QVector<int> &counts)
+{
+    m_counts.fill(0);
+    
+    quint16 *data = m_counts.data();
+    int size = m_counts.size();
+    for (int i = 0; i < counts.size(); ++i) {
+        qint64 index = firstEpochDay + i - m_firstDay;
+        if (index < 0)
+            continue;
+        if (index >= size)
+            break;
+        data[index] = static_cast<quint16>(qBound(0, counts.at(i), kMaxStoredCount));
+    }
+    
+    updateMaxCount();
+}
+
+void DayHeatmap::setTimestamps(const QVector<qint64> &sortedMSecsSinceEpoch)
+{
+    m_counts.fill(0);
+    
+    quint16 *data = m_counts.data();
+    int size = m_counts.size();
+    
+    // 当前所在本地日期的 [dayStart, dayEnd) 毫秒区间，时间戳落在区间内时直接累加
+    qint64 dayStart = 0;
+    qint64 dayEnd = 0;
+    qint64 index = -1;
+    bool hasDay = false;
+    
+    for (qint64 msecs : sortedMSecsSinceEpoch) {
+        if (!hasDay || msecs >= dayEnd || msecs < dayStart) {
+            QDate date = QDateTime::fromMSecsSinceEpoch(msecs).date();
+            dayStart = QDateTime(date, QTime(0, 0)).toMSecsSinceEpoch();
+            dayEnd = QDateTime(date.addDays(1), QTime(0, 0)).toMSecsSinceEpoch();
+            index = CivilDate::epochDay(date) - m_firstDay;
+            hasDay = true;
+        }
+        
+        if (index >= 0 && index < size && data[index] < kMaxStoredCount)
+            ++data[index];
+    }
+    
+    updateMaxCount();
+}
+
+void DayHeatmap::clear()
+{
+    m_counts.fill(0);
+    m_maxCount = 0;
+}
+
+bool DayHeatmap::isEmpty() const
+{
+    return m_maxCount == 0;
+}
+
+int DayHeatmap::maxCount() const
+{
+    return m_maxCount;
+}
+
+int DayHeatmap::count(qint64 epochDay) const
+{
+    qint64 index = epochDay - m_firstDay;
+    if (index < 0 || index >= m_counts.size())
+        return 0;
+    return m_counts.at(int(index));
+}
+
+int DayHeatmap::level(qint64 epochDay) const
+{
+    int value = count(epochDay);
+    if (value == 0)
+        return 0;
+    
+    // 按最大计数线性分级并向上取整，有记录的日子至少为 1 级
+    return (value * kMaxLevel + m_maxCount - 1) / m_maxCount;
+}
+
+void DayHeatmap::updateMaxCount()
+{
+    m_maxCount = 0;
+    for (quint16 value : m_counts)
+        m_maxCount = qMax(m_maxCount, int(value));
+}
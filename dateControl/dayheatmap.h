@@ -0,0 +1,47 @@
+#ifndef DAYHEATMAP_H
+#define DAYHEATMAP_H
+
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief 按日统计的事件计数表
+ * 
+ * 覆盖一段连续日期（默认 1900～2100，约 7.3 万天），按纪元日下标存放每天的计数；
+ * 批量写入一次完成，绘制时每个单元格的查询都是 O(1) 的数组读取
+ */
+class DayHeatmap
+{
+public:
+    // 热度等级 0～kMaxLevel，0 表示当天没有记录
+    static const int kMaxLevel = 4;
+
+public:
+    DayHeatmap();
+    
+    // 调整覆盖范围（含首尾），保留重叠部分的计数
+    void setRange(qint64 firstEpochDay, qint64 lastEpochDay);
+    qint64 firstDay() const;
+    qint64 lastDay() const;
+    
+    // 从 firstEpochDay 开始依次写入每天的计数，超出范围的部分忽略
+    void setCounts(qint64 firstEpochDay, const QVector<int> &counts);
+    // 按本地日期统计升序时间戳（毫秒），单次线性扫描，只在跨天时换算一次日期
+    void setTimestamps(const QVector<qint64> &sortedMSecsSinceEpoch);
+    void clear();
+    
+    bool isEmpty() const;
+    int maxCount() const;
+    int count(qint64 epochDay) const;
+    int level(qint64 epochDay) const;
+
+private:
+    void updateMaxCount();
+
+private:
+    qint64 m_firstDay;
+    QVector<quint16> m_counts;   // 超过 65535 的计数饱和处理
+    int m_maxCount;
+};
+
+#endif // DAYHEATMAP_H
@@ -0,0 +1,143 @@
+#include "glyphatlas.h"
+#include <QPainter>
+#include <QPaintDevice>
+#include <QFontMetrics>
+#include <cmath>
+
+namespace {
+
+// 每个字形四周的留白，容纳超出排版框的笔画
+const int kGlyphPadding = 2;
+
+// 图集每行的最大宽度（逻辑像素）
+const int kAtlasRowWidth = 512;
+
+// 字体、颜色组合超过上限时整体清空，防止无限增长
+const int kMaxPages = 16;
+
+} // namespace
+
+GlyphAtlas::GlyphAtlas(const QStringList &texts)
+    : m_texts(texts)
+{
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    clear();
+}
+
+void GlyphAtlas::drawText(QPainter &painter, const QRect &rect, const QString &text,
+                          const QFont &font, const QColor &color)
+{
+    qreal dpr = painter.device() ? painter.device()->devicePixelRatioF() : 1.0;
+    Page *page = findPage(font, color, dpr);
+    if (!page)
+        page = createPage(font, color, dpr);
+
+    auto it = page->entries.constFind(text);
+    if (it == page->entries.constEnd()) {
+        painter.save();
+        painter.setFont(font);
+        painter.setPen(color);
+        painter.drawText(rect, Qt::AlignCenter, text);
+        painter.restore();
+        return;
+    }
+
+    // 排版框在 rect 内居中，再对齐到设备像素，保证图像按 1:1 拷贝
+    const Entry &entry = it.value();
+    qreal left = rect.x() + (rect.width() - entry.advance) / 2.0 - kGlyphPadding;
+    qreal top = rect.y() + (rect.height() - page->lineHeight) / 2.0 - kGlyphPadding;
+    left = std::round(left * dpr) / dpr;
+    top = std::round(top * dpr) / dpr;
+
+    QRectF target(left, top, entry.source.width(), entry.source.height());
+    QRectF source(entry.source.x() * dpr, entry.source.y() * dpr,
+                  entry.source.width() * dpr, entry.source.height() * dpr);
+    painter.drawPixmap(target, page->pixmap, source);
+}
+
+void GlyphAtlas::setTexts(const QStringList &texts)
+{
+    m_texts = texts;
+    clear();
+}
+
+void GlyphAtlas::clear()
+{
+    qDeleteAll(m_pages);
+    m_pages.clear();
+}
+
+int GlyphAtlas::pageCount() const
+{
+    return m_pages.size();
+}
+
+GlyphAtlas::Page *GlyphAtlas::findPage(const QFont &font, const QColor &color, qreal dpr)
+{
+    // 页数很少，线性比较比拼接哈希键更省
+    for (Page *page : m_pages) {
+        if (page->dpr == dpr && page->color == color && page->font == font)
+            return page;
+    }
+    return nullptr;
+}
+
+GlyphAtlas::Page *GlyphAtlas::createPage(const QFont &font, const QColor &color, qreal dpr)
+{
+    if (m_pages.size() >= kMaxPages)
+        clear();
+
+    Page *page = new Page;
+    page->font = font;
+    page->color = color;
+    page->dpr = dpr;
+
+    QFontMetrics fm(font);
+    page->lineHeight = fm.height();
+    int cellHeight = fm.height() + kGlyphPadding * 2;
+
+    // 逐行排布所有文本
+    int x = 0;
+    int y = 0;
+    int atlasWidth = 0;
+    for (const QString &text : m_texts) {
+        if (text.isEmpty() || page->entries.contains(text))
+            continue;
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+        int advance = fm.horizontalAdvance(text);
+#else
+        int advance = fm.width(text);
+#endif
+        int cellWidth = advance + kGlyphPadding * 2;
+        if (x > 0 && x + cellWidth > kAtlasRowWidth) {
+            x = 0;
+            y += cellHeight;
+        }
+        page->entries.insert(text, Entry{QRectF(x, y, cellWidth, cellHeight), qreal(advance)});
+        x += cellWidth;
+        atlasWidth = qMax(atlasWidth, x);
+    }
+    int atlasHeight = page->entries.isEmpty() ? 0 : y + cellHeight;
+
+    if (atlasWidth > 0 && atlasHeight > 0) {
+        page->pixmap = QPixmap(QSize(atlasWidth, atlasHeight) * dpr);
+        page->pixmap.setDevicePixelRatio(dpr);
+        page->pixmap.fill(Qt::transparent);
+
+        QPainter painter(&page->pixmap);
+        painter.setRenderHint(QPainter::TextAntialiasing);
+        painter.setFont(font);
+        painter.setPen(color);
+        for (auto it = page->entries.constBegin(); it != page->entries.constEnd(); ++it) {
+            const QRectF &cell = it.value().source;
+            painter.drawText(QPointF(cell.x() + kGlyphPadding, cell.y() + kGlyphPadding + fm.ascent()),
+                             it.key());
+        }
+    }
+
+    m_pages.append(page);
+    return page;
+}
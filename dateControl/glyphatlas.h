@@ -0,0 +1,61 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <QFont>
+#include <QColor>
+#include <QPixmap>
+#include <QHash>
+#include <QRectF>
+#include <QStringList>
+#include <QVector>
+
+class QPainter;
+class QRect;
+
+/**
+ * @brief 日历文本字形图集
+ * 
+ * 把日号、周数、星期标题等固定短文本按（字体、颜色、设备像素比）预先光栅化到一张图上，
+ * 绘制时按居中位置直接拷贝图像，不再逐格排版文字
+ */
+class GlyphAtlas
+{
+public:
+    explicit GlyphAtlas(const QStringList &texts = QStringList());
+    ~GlyphAtlas();
+    
+    // 与 QPainter::drawText(rect, Qt::AlignCenter, text) 等效；图集外的文本直接绘制
+    void drawText(QPainter &painter, const QRect &rect, const QString &text,
+                  const QFont &font, const QColor &color);
+    
+    // 更换预先光栅化的文本集合，已有页面全部作废
+    void setTexts(const QStringList &texts);
+    void clear();
+    int pageCount() const;
+
+private:
+    Q_DISABLE_COPY(GlyphAtlas)
+    
+    struct Entry {
+        QRectF source;        // 图集中的位置（逻辑像素，含留白）
+        qreal advance;        // 文本宽度
+    };
+    
+    struct Page {
+        QFont font;
+        QColor color;
+        qreal dpr;
+        QPixmap pixmap;
+        qreal lineHeight;
+        QHash<QString, Entry> entries;
+    };
+    
+    Page *findPage(const QFont &font, const QColor &color, qreal dpr);
+    Page *createPage(const QFont &font, const QColor &color, qreal dpr);
+    
+private:
+    QStringList m_texts;
+    QVector<Page *> m_pages;
+};
+
+#endif // GLYPHATLAS_H
@@ -0,0 +1,122 @@
+#include "holidaytable.h"
+#include "civildate.h"
+#include <QFile>
+#include <QDate>
+#include <QRegularExpression>
+
+namespace {
+
+const quint32 kKindMask = 0x3;
+const int kNameShift = 2;
+
+// 一段连续日期最长一年，防止写错年份时插入大量条目
+const qint64 kMaxSpanDays = 366;
+
+} // namespace
+
+HolidayTable::HolidayTable()
+{
+}
+
+bool HolidayTable::loadFromFile(const QString &fileName, QString *errorMessage)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        if (errorMessage)
+            *errorMessage = file.errorString();
+        return false;
+    }
+    
+    return loadFromText(QString::fromUtf8(file.readAll()), errorMessage);
+}
+
+bool HolidayTable::loadFromText(const QString &text, QString *errorMessage)
+{
+    HolidayTable table;
+    const QStringList lines = text.split(QLatin1Char('\n'));
+    static const QRegularExpression separator(QStringLiteral("\\s+"));
+    
+    for (int i = 0; i < lines.size(); ++i) {
+        QString line = lines.at(i).trimmed();
+        if (line.isEmpty() || line.startsWith(QLatin1Char('#')))
+            continue;
+        
+        // 行首尾空白已去掉，按空白分隔不会产生空字段
+        QStringList fields = line.split(separator);
+        QStringList span = fields.value(0).split(QStringLiteral(".."));
+        QDate first = QDate::fromString(span.value(0), Qt::ISODate);
+        QDate last = span.size() > 1 ? QDate::fromString(span.value(1), Qt::ISODate) : first;
+        
+        const QString kindText = fields.value(1);
+        DayKind kind = NormalDay;
+        if (kindText == QStringLiteral("休") || kindText == QStringLiteral("holiday"))
+            kind = Holiday;
+        else if (kindText == QStringLiteral("班") || kindText == QStringLiteral("workday"))
+            kind = WorkDay;
+        
+        qint64 firstDay = CivilDate::epochDay(first);
+        qint64 lastDay = CivilDate::epochDay(last);
+        if (!first.isValid() || !last.isValid() || lastDay < firstDay
+            || lastDay - firstDay >= kMaxSpanDays || kind == NormalDay) {
+            if (errorMessage)
+                *errorMessage = QStringLiteral("第 %1 行格式错误：%2").arg(i + 1).arg(line);
+            return false;
+        }
+        
+        QString name = fields.mid(2).join(QLatin1Char(' '));
+        for (qint64 day = firstDay; day <= lastDay; ++day)
+            table.setDay(day, kind, name);
+    }
+    
+    *this = table;
+    return true;
+}
+
+void HolidayTable::setDay(qint64 epochDay, DayKind kind, const QString &name)
+{
+    if (kind == NormalDay) {
+        m_days.remove(epochDay);
+        return;
+    }
+    
+    quint32 index = name.isEmpty() ? 0 : quint32(nameIndex(name) + 1);
+    m_days.insert(epochDay, (index << kNameShift) | quint32(kind));
+}
+
+void HolidayTable::clear()
+{
+    m_days.clear();
+    m_names.clear();
+}
+
+bool HolidayTable::isEmpty() const
+{
+    return m_days.isEmpty();
+}
+
+HolidayTable::DayKind HolidayTable::kind(qint64 epochDay) const
+{
+    return static_cast<DayKind>(m_days.value(epochDay, 0) & kKindMask);
+}
+
+const QString &HolidayTable::name(qint64 epochDay) const
+{
+    quint32 index = m_days.value(epochDay, 0) >> kNameShift;
+    return index > 0 ? m_names.at(int(index) - 1) : m_empty;
+}
+
+QStringList HolidayTable::names() const
+{
+    return m_names;
+}
+
+int HolidayTable::nameIndex(const QString &name)
+{
+    // 名称种类很少（每年十来个），线性查找即可
+    int index = m_names.indexOf(name);
+    if (index < 0) {
+        m_names.append(name);
+        index = m_names.size() - 1;
+    }
+    return index;
+}
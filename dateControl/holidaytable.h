@@ -0,0 +1,55 @@
+#ifndef HOLIDAYTABLE_H
+#define HOLIDAYTABLE_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+
+/**
+ * @brief 法定节假日与调休表
+ * 
+ * 每年的放假、补班安排由国务院公布，不能推算，只能从本地文件加载；
+ * 按纪元日存放“休 / 班”标记和节日名称下标，每个单元格查询一次哈希
+ * 
+ * 文件格式（UTF-8，# 开头为注释）：
+ *   2024-02-10..2024-02-17 休 春节
+ *   2024-02-04 班
+ * 第二列也可写 holiday / workday
+ */
+class HolidayTable
+{
+public:
+    enum DayKind {
+        NormalDay = 0,
+        Holiday = 1,     // 放假
+        WorkDay = 2      // 调休补班
+    };
+
+public:
+    HolidayTable();
+    
+    // 加载成功返回 true，替换原有内容；格式错误时保留原内容并给出首个出错的行
+    bool loadFromFile(const QString &fileName, QString *errorMessage = nullptr);
+    bool loadFromText(const QString &text, QString *errorMessage = nullptr);
+    
+    void setDay(qint64 epochDay, DayKind kind, const QString &name = QString());
+    void clear();
+    bool isEmpty() const;
+    
+    DayKind kind(qint64 epochDay) const;
+    const QString &name(qint64 epochDay) const;
+    // 已出现过的节日名称，供字形图集预先光栅化
+    QStringList names() const;
+
+private:
+    int nameIndex(const QString &name);
+
+private:
+    // 低 2 位为 DayKind，其余为名称下标 + 1（0 表示无名称）
+    QHash<qint64, quint32> m_days;
+    QStringList m_names;
+    QString m_empty;
+};
+
+#endif // HOLIDAYTABLE_H
@@ -0,0 +1,271 @@
+#include "lunarcalendar.h"
+#include "civildate.h"
+
+namespace {
+
+/*
+ * 每年一项：
+ *   bit 0-3   闰月月份，0 表示无闰月
+ *   bit 4-15  正月～十二月的大小，bit 15 为正月，置位为大月（30 天）
+ *   bit 16    闰月为大月
+ */
+constexpr quint32 kLunarInfo[] = {
+    0x04bd8, 0x04ae0, 0x0a570, 0x054d5, 0x0d260, 0x0d950, 0x16554, 0x056a0, 0x09ad0, 0x055d2,  // 1900-1909
+    0x04ae0, 0x0a5b6, 0x0a4d0, 0x0d250, 0x1d255, 0x0b540, 0x0d6a0, 0x0ada2, 0x095b0, 0x14977,  // 1910-1919
+    0x04970, 0x0a4b0, 0x0b4b5, 0x06a50, 0x06d40, 0x1ab54, 0x02b60, 0x09570, 0x052f2, 0x04970,  // 1920-1929
+    0x06566, 0x0d4a0, 0x0ea50, 0x16a95, 0x05ad0, 0x02b60, 0x186e3, 0x092e0, 0x1c8d7, 0x0c950,  // 1930-1939
+    0x0d4a0, 0x1d8a6, 0x0b550, 0x056a0, 0x1a5b4, 0x025d0, 0x092d0, 0x0d2b2, 0x0a950, 0x0b557,  // 1940-1949
+    0x06ca0, 0x0b550, 0x15355, 0x04da0, 0x0a5b0, 0x14573, 0x052b0, 0x0a9a8, 0x0e950, 0x06aa0,  // 1950-1959
+    0x0aea6, 0x0ab50, 0x04b60, 0x0aae4, 0x0a570, 0x05260, 0x0f263, 0x0d950, 0x05b57, 0x056a0,  // 1960-1969
+    0x096d0, 0x04dd5, 0x04ad0, 0x0a4d0, 0x0d4d4, 0x0d250, 0x0d558, 0x0b540, 0x0b6a0, 0x195a6,  // 1970-1979
+    0x095b0, 0x049b0, 0x0a974, 0x0a4b0, 0x0b27a, 0x06a50, 0x06d40, 0x0af46, 0x0ab60, 0x09570,  // 1980-1989
+    0x04af5, 0x04970, 0x064b0, 0x074a3, 0x0ea50, 0x06b58, 0x05ac0, 0x0ab60, 0x096d5, 0x092e0,  // 1990-1999
+    0x0c960, 0x0d954, 0x0d4a0, 0x0da50, 0x07552, 0x056a0, 0x0abb7, 0x025d0, 0x092d0, 0x0cab5,  // 2000-2009
+    0x0a950, 0x0b4a0, 0x0baa4, 0x0ad50, 0x055d9, 0x04ba0, 0x0a5b0, 0x15176, 0x052b0, 0x0a930,  // 2010-2019
+    0x07954, 0x06aa0, 0x0ad50, 0x05b52, 0x04b60, 0x0a6e6, 0x0a4e0, 0x0d260, 0x0ea65, 0x0d530,  // 2020-2029
+    0x05aa0, 0x076a3, 0x096d0, 0x04afb, 0x04ad0, 0x0a4d0, 0x1d0b6, 0x0d250, 0x0d520, 0x0dd45,  // 2030-2039
+    0x0b5a0, 0x056d0, 0x055b2, 0x049b0, 0x0a577, 0x0a4b0, 0x0aa50, 0x1b255, 0x06d20, 0x0ada0,  // 2040-2049
+    0x14b63, 0x09370, 0x049f8, 0x04970, 0x064b0, 0x168a6, 0x0ea50, 0x06b20, 0x1a6c4, 0x0aae0,  // 2050-2059
+    0x092e0, 0x0d2e3, 0x0c960, 0x0d557, 0x0d4a0, 0x0da50, 0x05d55, 0x056a0, 0x0a6d0, 0x055d4,  // 2060-2069
+    0x052d0, 0x0a9b8, 0x0a950, 0x0b4a0, 0x0b6a6, 0x0ad50, 0x055a0, 0x0aba4, 0x0a5b0, 0x052b0,  // 2070-2079
+    0x0b273, 0x06930, 0x07337, 0x06aa0, 0x0ad50, 0x14b55, 0x04b60, 0x0a570, 0x054e4, 0x0d160,  // 2080-2089
+    0x0e968, 0x0d520, 0x0daa0, 0x16aa6, 0x056d0, 0x04ae0, 0x0a9d4, 0x0a2d0, 0x0d150, 0x0f252,  // 2090-2099
+    0x0d520,  // 2100
+};
+
+constexpr int kFirstYear = 1900;
+constexpr int kYearCount = sizeof(kLunarInfo) / sizeof(kLunarInfo[0]);
+
+constexpr int leapMonthOf(quint32 info)
+{
+    return static_cast<int>(info & 0xf);
+}
+
+constexpr int monthDaysOf(quint32 info, int month)
+{
+    return (info & (0x10000 >> month)) ? 30 : 29;
+}
+
+constexpr int leapDaysOf(quint32 info)
+{
+    return leapMonthOf(info) ? ((info & 0x10000) ? 30 : 29) : 0;
+}
+
+constexpr int yearDaysOf(quint32 info)
+{
+    int days = leapDaysOf(info);
+    for (int month = 1; month <= 12; ++month)
+        days += monthDaysOf(info, month);
+    return days;
+}
+
+// 编译期展开每年正月初一的纪元日，末项为 2101 年春节
+struct YearTable {
+    qint64 newYear[kYearCount + 1];
+};
+
+constexpr YearTable makeYearTable()
+{
+    YearTable table{};
+    qint64 day = CivilDate::daysFromCivil(1900, 1, 31);
+    for (int i = 0; i < kYearCount; ++i) {
+        table.newYear[i] = day;
+        day += yearDaysOf(kLunarInfo[i]);
+    }
+    table.newYear[kYearCount] = day;
+    return table;
+}
+
+constexpr YearTable kYearTable = makeYearTable();
+
+static_assert(kYearCount == 201, "农历表应覆盖 1900～2100 年");
+static_assert(kYearTable.newYear[2000 - kFirstYear] == CivilDate::daysFromCivil(2000, 2, 5), "2000 年春节");
+static_assert(kYearTable.newYear[2024 - kFirstYear] == CivilDate::daysFromCivil(2024, 2, 10), "2024 年春节");
+static_assert(kYearTable.newYear[2100 - kFirstYear] == CivilDate::daysFromCivil(2100, 2, 9), "2100 年春节");
+
+const char *const kDayNames[30] = {
+    "初一", "初二", "初三", "初四", "初五", "初六", "初七", "初八", "初九", "初十",
+    "十一", "十二", "十三", "十四", "十五", "十六", "十七", "十八", "十九", "二十",
+    "廿一", "廿二", "廿三", "廿四", "廿五", "廿六", "廿七", "廿八", "廿九", "三十"
+};
+
+const char *const kMonthNames[12] = {
+    "正月", "二月", "三月", "四月", "五月", "六月",
+    "七月", "八月", "九月", "十月", "冬月", "腊月"
+};
+
+struct Festival {
+    int month;
+    int day;
+    const char *name;
+};
+
+// 农历节日（除夕按腊月最后一天另行判断）
+const Festival kLunarFestivals[] = {
+    {1, 1, "春节"}, {1, 15, "元宵"}, {5, 5, "端午"}, {7, 7, "七夕"},
+    {7, 15, "中元"}, {8, 15, "中秋"}, {9, 9, "重阳"}, {12, 8, "腊八"}
+};
+const int kLunarFestivalCount = sizeof(kLunarFestivals) / sizeof(kLunarFestivals[0]);
+
+// 公历节日
+const Festival kSolarFestivals[] = {
+    {1, 1, "元旦"}, {3, 8, "妇女节"}, {5, 1, "劳动节"}, {5, 4, "青年节"},
+    {6, 1, "儿童节"}, {8, 1, "建军节"}, {9, 10, "教师节"}, {10, 1, "国庆节"}
+};
+const int kSolarFestivalCount = sizeof(kSolarFestivals) / sizeof(kSolarFestivals[0]);
+
+// 所有显示文本只构造一次，绘制时按下标返回引用
+struct NameTables {
+    QString days[30];
+    QString months[12];
+    QString leapMonths[12];
+    QString lunarFestivals[kLunarFestivalCount];
+    QString solarFestivals[kSolarFestivalCount];
+    QString newYearEve;
+    QString empty;
+    
+    NameTables()
+        : newYearEve(QString::fromUtf8("除夕"))
+    {
+        for (int i = 0; i < 30; ++i)
+            days[i] = QString::fromUtf8(kDayNames[i]);
+        for (int i = 0; i < 12; ++i) {
+            months[i] = QString::fromUtf8(kMonthNames[i]);
+            leapMonths[i] = QString::fromUtf8("闰") + months[i];
+        }
+        for (int i = 0; i < kLunarFestivalCount; ++i)
+            lunarFestivals[i] = QString::fromUtf8(kLunarFestivals[i].name);
+        for (int i = 0; i < kSolarFestivalCount; ++i)
+            solarFestivals[i] = QString::fromUtf8(kSolarFestivals[i].name);
+    }
+};
+
+const NameTables &names()
+{
+    static const NameTables tables;
+    return tables;
+}
+
+} // namespace
+
+namespace LunarCalendar {
+
+qint64 firstEpochDay()
+{
+    return kYearTable.newYear[0];
+}
+
+qint64 lastEpochDay()
+{
+    return kYearTable.newYear[kYearCount] - 1;
+}
+
+bool isSupported(qint64 epochDay)
+{
+    return epochDay >= firstEpochDay() && epochDay <= lastEpochDay();
+}
+
+LunarDate fromEpochDay(qint64 epochDay)
+{
+    LunarDate lunar = {0, 0, 0, false, 0};
+    if (!isSupported(epochDay))
+        return lunar;
+    
+    // 按回归年长度估算年份，再前后修正（至多一年）
+    qint64 offset = epochDay - kYearTable.newYear[0];
+    int index = qBound(0, static_cast<int>(offset * 10000 / 3652422), kYearCount - 1);
+    while (epochDay < kYearTable.newYear[index])
+        --index;
+    while (epochDay >= kYearTable.newYear[index + 1])
+        ++index;
+    
+    // 年内最多 13 个月
+    quint32 info = kLunarInfo[index];
+    int leap = leapMonthOf(info);
+    int dayOfYear = static_cast<int>(epochDay - kYearTable.newYear[index]);
+    
+    lunar.year = kFirstYear + index;
+    for (int month = 1; month <= 12; ++month) {
+        int days = monthDaysOf(info, month);
+        if (dayOfYear < days) {
+            lunar.month = month;
+            lunar.day = dayOfYear + 1;
+            lunar.monthDays = days;
+            return lunar;
+        }
+        dayOfYear -= days;
+        
+        if (month == leap) {
+            int leapDays = leapDaysOf(info);
+            if (dayOfYear < leapDays) {
+                lunar.month = month;
+                lunar.day = dayOfYear + 1;
+                lunar.isLeapMonth = true;
+                lunar.monthDays = leapDays;
+                return lunar;
+            }
+            dayOfYear -= leapDays;
+        }
+    }
+    
+    return LunarDate{0, 0, 0, false, 0};
+}
+
+int leapMonth(int year)
+{
+    if (year < kFirstYear || year >= kFirstYear + kYearCount)
+        return 0;
+    return leapMonthOf(kLunarInfo[year - kFirstYear]);
+}
+
+const QString &dayName(int day)
+{
+    return names().days[qBound(1, day, 30) - 1];
+}
+
+const QString &monthName(int month, bool isLeapMonth)
+{
+    int index = qBound(1, month, 12) - 1;
+    return isLeapMonth ? names().leapMonths[index] : names().months[index];
+}
+
+const QString &festivalName(const LunarDate &lunar, int solarMonth, int solarDay)
+{
+    const NameTables &tables = names();
+    
+    if (lunar.month > 0 && !lunar.isLeapMonth) {
+        if (lunar.month == 12 && lunar.day == lunar.monthDays)
+            return tables.newYearEve;
+        for (int i = 0; i < kLunarFestivalCount; ++i) {
+            if (kLunarFestivals[i].month == lunar.month && kLunarFestivals[i].day == lunar.day)
+                return tables.lunarFestivals[i];
+        }
+    }
+    
+    for (int i = 0; i < kSolarFestivalCount; ++i) {
+        if (kSolarFestivals[i].month == solarMonth && kSolarFestivals[i].day == solarDay)
+            return tables.solarFestivals[i];
+    }
+    
+    return tables.empty;
+}
+
+QStringList allNames()
+{
+    const NameTables &tables = names();
+    QStringList result;
+    for (const QString &name : tables.days)
+        result.append(name);
+    for (const QString &name : tables.months)
+        result.append(name);
+    for (const QString &name : tables.leapMonths)
+        result.append(name);
+    for (const QString &name : tables.lunarFestivals)
+        result.append(name);
+    for (const QString &name : tables.solarFestivals)
+        result.append(name);
+    result.append(tables.newYearEve);
+    return result;
+}
+
+} // namespace LunarCalendar
@@ -0,0 +1,45 @@
+#ifndef LUNARCALENDAR_H
+#define LUNARCALENDAR_H
+
+#include <QtGlobal>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief 农历日期换算
+ *
+ * 1900～2100 年的农历月大小与闰月信息在编译期展开为每年春节的纪元日表，
+ * 换算时按表定位年份再数月份，每个日期的查询只需常数次整数运算
+ */
+namespace LunarCalendar {
+
+struct LunarDate {
+    int year;
+    int month;          // 1～12，范围外为 0
+    int day;            // 1～30
+    bool isLeapMonth;
+    int monthDays;      // 当月天数 29 或 30
+};
+
+// 支持范围：1900-01-31（农历 1900 年正月初一）至 2101 年春节前一天
+qint64 firstEpochDay();
+qint64 lastEpochDay();
+bool isSupported(qint64 epochDay);
+
+// 纪元日 -> 农历日期；范围外返回全 0
+LunarDate fromEpochDay(qint64 epochDay);
+
+// 闰月月份，无闰月返回 0
+int leapMonth(int year);
+
+// 预先生成的显示文本：初一～三十、正月～腊月（含闰月）
+const QString &dayName(int day);
+const QString &monthName(int month, bool isLeapMonth);
+// 农历和公历固定节日，没有时返回空字符串
+const QString &festivalName(const LunarDate &lunar, int solarMonth, int solarDay);
+// 以上全部文本，供字形图集预先光栅化
+QStringList allNames();
+
+} // namespace LunarCalendar
+
+#endif // LUNARCALENDAR_H
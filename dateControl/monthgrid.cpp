@@ -0,0 +1,168 @@
+#include "monthgrid.h"
+#include "civildate.h"
+
+MonthGrid::MonthGrid()
+    : m_valid(false)
+    , m_year(0)
+    , m_month(0)
+    , m_todayEpochDay(0)
+    , m_showWeekNumbers(false)
+    , m_cellWidth(0)
+    , m_cellHeight(0)
+    , m_startColumn(0)
+    , m_firstEpochDay(0)
+    , m_cells()
+    , m_weekNumbers()
+{
+}
+
+bool MonthGrid::rebuild(int year, int month, qint64 todayEpochDay, const QRect &calendarRect, bool showWeekNumbers)
+{
+    if (m_valid && year == m_year && month == m_month && todayEpochDay == m_todayEpochDay
+        && calendarRect == m_calendarRect && showWeekNumbers == m_showWeekNumbers) {
+        return false;
+    }
+
+    m_valid = true;
+    m_year = year;
+    m_month = month;
+    m_todayEpochDay = todayEpochDay;
+    m_calendarRect = calendarRect;
+    m_showWeekNumbers = showWeekNumbers;
+
+    // 1 行星期标题 + 6 行日期；显示周数时左侧多一列
+    int cols = showWeekNumbers ? kColumns + 1 : kColumns;
+    m_cellWidth = calendarRect.width() / cols;
+    m_cellHeight = calendarRect.height() / (kRows + 1);
+    m_startColumn = showWeekNumbers ? 1 : 0;
+
+    // 网格从本月 1 日所在周的星期一开始
+    qint64 firstOfMonth = CivilDate::daysFromCivil(year, month, 1);
+    m_firstEpochDay = firstOfMonth - (CivilDate::weekdayFromDays(firstOfMonth) - 1);
+    int monthDays = CivilDate::daysInMonth(year, month);
+    int prevMonthDays = CivilDate::daysInMonth(month == 1 ? year - 1 : year, month == 1 ? 12 : month - 1);
+    int leading = static_cast<int>(firstOfMonth - m_firstEpochDay);
+
+    for (int i = 0; i < kCellCount; ++i) {
+        int row = i / kColumns;
+        int column = i % kColumns;
+        Cell &cell = m_cells[i];
+        cell.epochDay = m_firstEpochDay + i;
+
+        // 日号按与 1 日的偏移直接推出，不做日期换算
+        int offset = i - leading;
+        int flags = 0;
+        if (offset < 0) {
+            cell.day = prevMonthDays + offset + 1;
+        } else if (offset < monthDays) {
+            cell.day = offset + 1;
+            flags |= CurrentMonth;
+        } else {
+            cell.day = offset - monthDays + 1;
+        }
+        if (column >= 5)
+            flags |= Weekend;
+        if (cell.epochDay == todayEpochDay)
+            flags |= Today;
+        cell.flags = flags;
+
+        cell.rect = QRect(calendarRect.left() + (m_startColumn + column) * m_cellWidth,
+                          calendarRect.top() + (row + 1) * m_cellHeight,
+                          m_cellWidth, m_cellHeight);
+    }
+
+    for (int row = 0; row < kRows; ++row) {
+        m_weekNumbers[row] = CivilDate::isoWeekNumber(m_firstEpochDay + row * kColumns);
+    }
+    return true;
+}
+
+void MonthGrid::invalidate()
+{
+    m_valid = false;
+}
+
+bool MonthGrid::isValid() const
+{
+    return m_valid;
+}
+
+int MonthGrid::year() const
+{
+    return m_year;
+}
+
+int MonthGrid::month() const
+{
+    return m_month;
+}
+
+int MonthGrid::cellWidth() const
+{
+    return m_cellWidth;
+}
+
+int MonthGrid::cellHeight() const
+{
+    return m_cellHeight;
+}
+
+const MonthGrid::Cell &MonthGrid::cell(int index) const
+{
+    return m_cells[index];
+}
+
+QRect MonthGrid::weekdayTitleRect(int column) const
+{
+    return QRect(m_calendarRect.left() + (m_startColumn + column) * m_cellWidth,
+                 m_calendarRect.top(), m_cellWidth, m_cellHeight);
+}
+
+QRect MonthGrid::weekNumberRect(int row) const
+{
+    return QRect(m_calendarRect.left(), m_calendarRect.top() + (row + 1) * m_cellHeight,
+                 m_cellWidth, m_cellHeight);
+}
+
+int MonthGrid::weekNumber(int row) const
+{
+    return m_weekNumbers[row];
+}
+
+int MonthGrid::indexOf(qint64 epochDay) const
+{
+    qint64 index = epochDay - m_firstEpochDay;
+    return m_valid && index >= 0 && index < kCellCount ? static_cast<int>(index) : -1;
+}
+
+int MonthGrid::indexAt(const QPoint &pos) const
+{
+    if (!m_valid || m_cellWidth <= 0 || m_cellHeight <= 0 || !m_calendarRect.contains(pos))
+        return -1;
+
+    int column = (pos.x() - m_calendarRect.left()) / m_cellWidth - m_startColumn;
+    int row = (pos.y() - m_calendarRect.top()) / m_cellHeight - 1; // 减去标题行
+    if (column < 0 || column >= kColumns || row < 0 || row >= kRows)
+        return -1;
+    return row * kColumns + column;
+}
+
+const QString &MonthGrid::numberText(int number)
+{
+    static const QString *texts = [] {
+        static QString table[kMaxNumberText + 1];
+        for (int i = 0; i <= kMaxNumberText; ++i)
+            table[i] = QString::number(i);
+        return table;
+    }();
+    return texts[qBound(0, number, int(kMaxNumberText))];
+}
+
+const QString &MonthGrid::weekdayTitle(int column)
+{
+    static const QString titles[kColumns] = {
+        QStringLiteral("日"), QStringLiteral("一"), QStringLiteral("二"), QStringLiteral("三"),
+        QStringLiteral("四"), QStringLiteral("五"), QStringLiteral("六")
+    };
+    return titles[qBound(0, column, kColumns - 1)];
+}
@@ -0,0 +1,78 @@
+#ifndef MONTHGRID_H
+#define MONTHGRID_H
+
+#include <QRect>
+#include <QString>
+#include <QPoint>
+
+/**
+ * @brief 月视图网格模型
+ * 
+ * 6 周 × 7 天的日期网格（周一开始），在月份、布局或“今天”变化时整体重建一次；
+ * 绘制和点击检测都直接读取其中的纪元日、日号、标志和单元格矩形
+ */
+class MonthGrid
+{
+public:
+    enum CellFlag {
+        CurrentMonth = 0x1,   // 属于当前显示的月份
+        Weekend = 0x2,        // 星期六、星期日
+        Today = 0x4           // 今天
+    };
+    
+    struct Cell {
+        qint64 epochDay;      // 纪元日（1970-01-01 为 0）
+        int day;              // 日号 1～31
+        int flags;
+        QRect rect;
+    };
+    
+    static const int kRows = 6;
+    static const int kColumns = 7;
+    static const int kCellCount = kRows * kColumns;
+
+public:
+    MonthGrid();
+    
+    // 参数与上次构建相同时不做任何事，返回是否重建
+    bool rebuild(int year, int month, qint64 todayEpochDay, const QRect &calendarRect, bool showWeekNumbers);
+    void invalidate();
+    bool isValid() const;
+    
+    int year() const;
+    int month() const;
+    int cellWidth() const;
+    int cellHeight() const;
+    
+    const Cell &cell(int index) const;
+    QRect weekdayTitleRect(int column) const;
+    QRect weekNumberRect(int row) const;
+    int weekNumber(int row) const;
+    
+    // 纪元日所在的单元格序号，不在网格内返回 -1
+    int indexOf(qint64 epochDay) const;
+    // 坐标所在的单元格序号，O(1)，不在日期区域返回 -1
+    int indexAt(const QPoint &pos) const;
+    
+    // 预先生成的数字文本（日号、周数，0～53）与星期标题
+    static const int kMaxNumberText = 53;
+    static const QString &numberText(int number);
+    static const QString &weekdayTitle(int column);
+
+private:
+    bool m_valid;
+    int m_year;
+    int m_month;
+    qint64 m_todayEpochDay;
+    QRect m_calendarRect;
+    bool m_showWeekNumbers;
+    
+    int m_cellWidth;
+    int m_cellHeight;
+    int m_startColumn;
+    qint64 m_firstEpochDay;
+    Cell m_cells[kCellCount];
+    int m_weekNumbers[kRows];
+};
+
+#endif // MONTHGRID_H
@@ -8,7 +8,8 @@ TEMPLATE = app
 # 包含主库的头文件
 INCLUDEPATH += . \
     ../dateControl \
-    ../timePlay
+    ../timePlay \
+    ../timeline
 
 # 直接包含源文件
 SOURCES += \
@@ -19,7 +20,17 @@ SOURCES += \
     integrated_demo_window.cpp \
     ../dateControl/datecontrol.cpp \
     ../dateControl/datepicker.cpp \
-    ../timePlay/timeplaycontrol.cpp
+    ../dateControl/monthgrid.cpp \
+    ../dateControl/glyphatlas.cpp \
+    ../dateControl/dayheatmap.cpp \
+    ../dateControl/datebitset.cpp \
+    ../dateControl/lunarcalendar.cpp \
+    ../dateControl/holidaytable.cpp \
+    ../timePlay/timeplaycontrol.cpp \
+    ../timePlay/playhead.cpp \
+    ../timePlay/playbackclock.cpp \
+    ../timeline/framedriver.cpp \
+    ../timeline/timelineclock.cpp
 
 HEADERS += \
     timeContral_global.h \
@@ -29,7 +40,18 @@ HEADERS += \
     integrated_demo_window.h \
     ../dateControl/datecontrol.h \
     ../dateControl/datepicker.h \
-    ../timePlay/timeplaycontrol.h
+    ../dateControl/civildate.h \
+    ../dateControl/monthgrid.h \
+    ../dateControl/glyphatlas.h \
+    ../dateControl/dayheatmap.h \
+    ../dateControl/datebitset.h \
+    ../dateControl/lunarcalendar.h \
+    ../dateControl/holidaytable.h \
+    ../timePlay/timeplaycontrol.h \
+    ../timePlay/playhead.h \
+    ../timePlay/playbackclock.h \
+    ../timeline/framedriver.h \
+    ../timeline/timelineclock.h
 
 # 定义库符号
 DEFINES += TIMECONTRAL_LIBRARY
@@ -18,9 +18,9 @@ IntegratedDemoWindow::IntegratedDemoWindow(QWidget *parent)
     , m_playSection(nullptr)
     , m_timePlayControl(nullptr)
     , m_playInfoLabel(nullptr)
+    , m_clock(nullptr)
     , m_currentDate(QDate::currentDate())
-    , m_currentHour(12)
-    , m_baseDateTime(QDateTime::currentDateTime())
+    , m_currentHour(-1)
 {
     setWindowTitle("集成演示 - 日期控制器与时间轴播放控件联动");
     setMinimumSize(1000, 800);
@@ -30,10 +30,11 @@ IntegratedDemoWindow::IntegratedDemoWindow(QWidget *parent)
     setAttribute(Qt::WA_TranslucentBackground);
     
     setupUI();
-    setupConnections();
     
     // 初始化时间轴
     updateTimelineForDate(m_currentDate);
+    
+    setupConnections();
 }
 
 IntegratedDemoWindow::~IntegratedDemoWindow()
@@ -145,13 +146,21 @@ void IntegratedDemoWindow::setupUI()
 
 void IntegratedDemoWindow::setupConnections()
 {
+    // 三个控件挂接到同一个时钟，时间、范围和播放状态由时钟统一分发
+    m_clock = new TimelineClock(this);
+    m_clock->setVisibleRange(m_timeContral->visibleStartTime(), m_timeContral->visibleEndTime());
+    m_clock->setCurrentTime(m_timeContral->currentTime());
+    m_clock->attach(m_timeContral);
+    m_clock->attach(m_timePlayControl);
+    m_clock->attach(m_datePicker);
+    connect(m_clock, &TimelineClock::changed, this, &IntegratedDemoWindow::onClockChanged);
+    
     // 连接日期选择器信号
     connect(m_datePicker, &DatePicker::dateChanged, this, &IntegratedDemoWindow::onDateChanged);
     connect(m_datePicker, &DatePicker::dateSelected, this, &IntegratedDemoWindow::onDateSelected);
     
     // 连接播放控制器信号
     connect(m_timePlayControl, &TimePlayControl::playStateChanged, this, &IntegratedDemoWindow::onPlayStateChanged);
-    connect(m_timePlayControl, &TimePlayControl::currentTimeChanged, this, &IntegratedDemoWindow::onCurrentTimeChanged);
     connect(m_timePlayControl, &TimePlayControl::stepForwardClicked, this, &IntegratedDemoWindow::onStepForwardClicked);
     connect(m_timePlayControl, &TimePlayControl::stepBackwardClicked, this, &IntegratedDemoWindow::onStepBackwardClicked);
     connect(m_timePlayControl, &TimePlayControl::playClicked, this, &IntegratedDemoWindow::onPlayClicked);
@@ -160,6 +169,7 @@ void IntegratedDemoWindow::setupConnections()
     // 设置播放控制器参数
     m_timePlayControl->setStepInterval(3600); // 1小时 = 3600秒
     m_timePlayControl->setPlaySpeed(1.0);     // 每3秒前进1小时，通过定时器间隔控制
+    m_timePlayControl->setContinuousPlayback(true); // 气泡随播放平滑移动
 }
 
 void IntegratedDemoWindow::onDateChanged(const QDate &date)
@@ -174,9 +184,7 @@ void IntegratedDemoWindow::onDateChanged(const QDate &date)
 void IntegratedDemoWindow::onDateSelected(const QDate &date)
 {
     m_currentDate = date;
-    m_currentHour = 12; // 重置到12点
     updateTimelineForDate(date);
-    moveTimelineBubbleToHour(12);
     
     m_dateInfoLabel->setText(QString("✅ 确认选择日期: %1，时间轴设置为 12:00")
                             .arg(date.toString("yyyy年MM月dd日")));
@@ -202,13 +210,17 @@ void IntegratedDemoWindow::onPlayStateChanged(TimePlayControl::PlayState state)
     m_playInfoLabel->setText(QString("播放状态: %1").arg(stateText));
 }
 
-void IntegratedDemoWindow::onCurrentTimeChanged(const QDateTime &time)
+void IntegratedDemoWindow::onClockChanged(TimelineClock::Changes changes)
 {
-    // 当播放控制器的时间改变时，更新时间轴气泡位置
+    // 控件之间的同步由时钟完成，这里只刷新说明文字；小时不变时不改标签
+    if (!(changes & TimelineClock::TimeChange))
+        return;
+    
+    QDateTime time = m_clock->currentTime();
+    m_currentDate = time.date();
     int hour = time.time().hour();
     if (hour != m_currentHour) {
         m_currentHour = hour;
-        moveTimelineBubbleToHour(hour);
         
         m_timelineInfoLabel->setText(QString("时间轴当前时间: %1 %2:00")
                                     .arg(m_currentDate.toString("yyyy-MM-dd"))
@@ -218,28 +230,15 @@ void IntegratedDemoWindow::onCurrentTimeChanged(const QDateTime &time)
 
 void IntegratedDemoWindow::onStepForwardClicked()
 {
-    // 下一个小时
-    m_currentHour = (m_currentHour + 1) % 24;
-    moveTimelineBubbleToHour(m_currentHour);
-    
-    // 更新播放控制器的当前时间
-    QDateTime newTime(m_currentDate, QTime(m_currentHour, 0));
-    m_timePlayControl->setCurrentTime(newTime);
-    
-    m_playInfoLabel->setText(QString("⏭ 前进到 %1:00").arg(m_currentHour, 2, 10, QChar('0')));
+    // 播放控件已前进一步，时钟会把新时间同步到时间轴
+    QTime time = m_timePlayControl->currentStepTime().time();
+    m_playInfoLabel->setText(QString("⏭ 前进到 %1:00").arg(time.hour(), 2, 10, QChar('0')));
 }
 
 void IntegratedDemoWindow::onStepBackwardClicked()
 {
-    // 上一个小时
-    m_currentHour = (m_currentHour - 1 + 24) % 24;
-    moveTimelineBubbleToHour(m_currentHour);
-    
-    // 更新播放控制器的当前时间
-    QDateTime newTime(m_currentDate, QTime(m_currentHour, 0));
-    m_timePlayControl->setCurrentTime(newTime);
-    
-    m_playInfoLabel->setText(QString("⏮ 后退到 %1:00").arg(m_currentHour, 2, 10, QChar('0')));
+    QTime time = m_timePlayControl->currentStepTime().time();
+    m_playInfoLabel->setText(QString("⏮ 后退到 %1:00").arg(time.hour(), 2, 10, QChar('0')));
 }
 
 void IntegratedDemoWindow::onPlayClicked()
@@ -259,27 +258,19 @@ void IntegratedDemoWindow::updateTimelineForDate(const QDate &date)
     QDateTime endTime(date, QTime(23, 59, 59));
     QDateTime currentTime(date, QTime(12, 0, 0)); // 默认设置为12:00
     
+    // 时间轴的总范围不属于共享状态，直接设置
     m_timeContral->setTimeRange(startTime, endTime);
-    m_timeContral->setVisibleTimeRange(startTime, endTime);
-    m_timeContral->setCurrentTime(currentTime);
-    
-    // 更新播放控制器的时间范围
-    m_timePlayControl->setTimeRange(startTime, endTime);
-    m_timePlayControl->setCurrentTime(currentTime);
     
-    m_baseDateTime = startTime;
-    m_currentHour = 12;
-}
-
-void IntegratedDemoWindow::moveTimelineBubbleToHour(int hour)
-{
-    // 移动时间轴气泡到指定小时
-    QDateTime targetTime(m_currentDate, QTime(hour, 0, 0));
-    m_timeContral->setCurrentTime(targetTime);
-    
-    m_timelineInfoLabel->setText(QString("时间轴气泡移动到: %1 %2:00")
-                                .arg(m_currentDate.toString("yyyy-MM-dd"))
-                                .arg(hour, 2, 10, QChar('0')));
+    if (m_clock) {
+        // 可见范围和当前时间交给时钟，下一帧一次性推送给三个控件
+        m_clock->setVisibleRange(startTime, endTime);
+        m_clock->setCurrentTime(currentTime);
+    } else {
+        m_timeContral->setVisibleTimeRange(startTime, endTime);
+        m_timeContral->setCurrentTime(currentTime);
+        m_timePlayControl->setTimeRange(startTime, endTime);
+        m_timePlayControl->setCurrentTime(currentTime);
+    }
 }
 
 void IntegratedDemoWindow::paintEvent(QPaintEvent *event)
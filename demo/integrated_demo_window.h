@@ -9,6 +9,7 @@
 #include "../dateControl/datepicker.h"
 #include "../timePlay/timeplaycontrol.h"
 #include "timecontral.h"
+#include "../timeline/timelineclock.h"
 
 /**
  * @brief 集成演示窗口 - 日期控制器与时间轴播放控件联动
@@ -25,7 +26,7 @@ private slots:
     void onDateChanged(const QDate &date);
     void onDateSelected(const QDate &date);
     void onPlayStateChanged(TimePlayControl::PlayState state);
-    void onCurrentTimeChanged(const QDateTime &time);
+    void onClockChanged(TimelineClock::Changes changes);
     void onStepForwardClicked();
     void onStepBackwardClicked();
     void onPlayClicked();
@@ -38,7 +39,6 @@ private:
     void setupUI();
     void setupConnections();
     void updateTimelineForDate(const QDate &date);
-    void moveTimelineBubbleToHour(int hour);
     
 private:
     QWidget *m_centralWidget;
@@ -59,10 +59,12 @@ private:
     TimePlayControl *m_timePlayControl;
     QLabel *m_playInfoLabel;
     
+    // 三个控件共享的时间轴时钟
+    TimelineClock *m_clock;
+    
     // 当前状态
     QDate m_currentDate;
     int m_currentHour;
-    QDateTime m_baseDateTime;
 };
 
 #endif // INTEGRATED_DEMO_WINDOW_H
\ No newline at end of file
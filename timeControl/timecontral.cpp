@@ -14,6 +14,9 @@
 #include <QBrush>
 #include <QPen>
 #include <QFont>
+#include <algorithm>
+#include <QPixmap>
+#include <QRegion>
 
 // 私有实现类，用于隐藏实现细节
 class TimeContral::Private
@@ -39,6 +42,7 @@ public:
         , m_showTimeBubble(true)
         , m_showDateOnTimeline(true)
         , m_infiniteScrollEnabled(true)
+        , m_staticLayerDirty(true)
     {
     }
 
@@ -67,6 +71,10 @@ public:
     
     // 滚动选项
     bool m_infiniteScrollEnabled;
+    
+    // 静态图层缓存（背景、刻度、时间项、日期），当前时间指示器作为覆盖层单独绘制
+    QPixmap m_staticLayer;
+    bool m_staticLayerDirty;
 };
 
 TimeContral::TimeContral(QWidget *parent)
@@ -98,7 +106,7 @@ void TimeContral::setTimeRange(const QDateTime &minTime, const QDateTime &maxTim
         d->m_visibleEndTime = maxTime;
 
     emit timeRangeChanged(d->m_minTime, d->m_maxTime);
-    update();
+    invalidateStaticLayer();
 }
 
 QDateTime TimeContral::minTime() const
@@ -128,7 +136,7 @@ void TimeContral::setVisibleTimeRange(const QDateTime &startTime, const QDateTim
     d->m_visibleEndTime = end;
 
     emit visibleTimeRangeChanged(d->m_visibleStartTime, d->m_visibleEndTime);
-    update();
+    invalidateStaticLayer();
 }
 
 QDateTime TimeContral::visibleStartTime() const
@@ -153,7 +161,7 @@ int TimeContral::addTimePoint(const QDateTime &time, const QString &label,
     item.userData = userData;
 
     d->m_timeItems.append(item);
-    update();
+    invalidateStaticLayer();
     return d->m_timeItems.size() - 1;
 }
 
@@ -172,7 +180,7 @@ int TimeContral::addTimeSpan(const QDateTime &startTime, const QDateTime &endTim
     item.userData = userData;
 
     d->m_timeItems.append(item);
-    update();
+    invalidateStaticLayer();
     return d->m_timeItems.size() - 1;
 }
 
@@ -188,7 +196,7 @@ bool TimeContral::removeTimeItem(int index)
     else if (d->m_currentIndex > index)
         d->m_currentIndex--;
 
-    update();
+    invalidateStaticLayer();
     return true;
 }
 
@@ -196,7 +204,7 @@ void TimeContral::clearTimeItems()
 {
     d->m_timeItems.clear();
     d->m_currentIndex = -1;
-    update();
+    invalidateStaticLayer();
 }
 
 int TimeContral::timeItemCount() const
@@ -212,6 +220,29 @@ TimeContral::TimeItem TimeContral::timeItemAt(int index) const
     return d->m_timeItems.at(index);
 }
 
+QVector<qint64> TimeContral::timeItemStartTimes() const
+{
+    QVector<qint64> times;
+    times.reserve(d->m_timeItems.size());
+    for (const TimeItem &item : d->m_timeItems) {
+        times.append(item.startTime.toMSecsSinceEpoch());
+    }
+    std::sort(times.begin(), times.end());
+    return times;
+}
+
+QVector<QPair<qint64, qint64>> TimeContral::timeSpanRanges() const
+{
+    QVector<QPair<qint64, qint64>> ranges;
+    for (const TimeItem &item : d->m_timeItems) {
+        if (!item.isPoint) {
+            ranges.append(qMakePair(item.startTime.toMSecsSinceEpoch(), item.endTime.toMSecsSinceEpoch()));
+        }
+    }
+    std::sort(ranges.begin(), ranges.end());
+    return ranges;
+}
+
 void TimeContral::setCurrentTimeItem(int index)
 {
     if (index < -1 || index >= d->m_timeItems.size())
@@ -220,7 +251,7 @@ void TimeContral::setCurrentTimeItem(int index)
     if (d->m_currentIndex != index) {
         d->m_currentIndex = index;
         emit currentTimeItemChanged(index);
-        update();
+        invalidateStaticLayer();
     }
 }
 
@@ -232,39 +263,42 @@ int TimeContral::currentTimeItem() const
 void TimeContral::setBackgroundColor(const QColor &color)
 {
     d->m_backgroundColor = color;
-    update();
+    invalidateStaticLayer();
 }
 
 void TimeContral::setScaleColor(const QColor &color)
 {
     d->m_scaleColor = color;
-    update();
+    invalidateStaticLayer();
 }
 
 void TimeContral::setTextColor(const QColor &color)
 {
     d->m_textColor = color;
-    update();
+    invalidateStaticLayer();
 }
 
 void TimeContral::setScaleHeight(int height)
 {
     d->m_scaleHeight = height;
-    update();
+    invalidateStaticLayer();
 }
 
 void TimeContral::setTimeFormat(const QString &format)
 {
     d->m_timeFormat = format;
-    update();
+    invalidateStaticLayer();
 }
 
 void TimeContral::setCurrentTime(const QDateTime &time)
 {
     if (d->m_currentTime != time) {
+        // 只重绘新旧指示器所在区域，静态图层直接复用缓存
+        QRegion dirty(currentTimeIndicatorRect(d->m_currentTime));
         d->m_currentTime = time;
+        dirty += currentTimeIndicatorRect(d->m_currentTime);
         emit currentTimeChanged(time);
-        update();
+        update(dirty);
     }
 }
 
@@ -287,7 +321,7 @@ bool TimeContral::isShowTimeBubble() const
 void TimeContral::setShowDateOnTimeline(bool show)
 {
     d->m_showDateOnTimeline = show;
-    update();
+    invalidateStaticLayer();
 }
 
 bool TimeContral::isShowDateOnTimeline() const
@@ -316,7 +350,7 @@ void TimeContral::setZoomLevel(double level)
         return;
 
     d->m_zoomLevel = level;
-    update();
+    invalidateStaticLayer();
 }
 
 double TimeContral::zoomLevel() const
@@ -338,9 +372,35 @@ void TimeContral::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
     
+    qreal dpr = devicePixelRatioF();
+    if (d->m_staticLayerDirty || d->m_staticLayer.size() != size() * dpr) {
+        renderStaticLayer();
+    }
+    
     QPainter painter(this);
+    painter.drawPixmap(0, 0, d->m_staticLayer);
     painter.setRenderHint(QPainter::Antialiasing);
     
+    // 绘制当前时间指示器
+    drawCurrentTimeIndicator(painter);
+    
+    // 绘制当前时间气泡
+    if (d->m_showTimeBubble) {
+        drawTimeBubble(painter);
+    }
+}
+
+void TimeContral::renderStaticLayer()
+{
+    qreal dpr = devicePixelRatioF();
+    d->m_staticLayer = QPixmap(size() * dpr);
+    d->m_staticLayer.setDevicePixelRatio(dpr);
+    d->m_staticLayer.fill(Qt::transparent);
+    
+    QPainter painter(&d->m_staticLayer);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setFont(font());
+    
     // 绘制背景
     drawBackground(painter);
     
@@ -350,15 +410,59 @@ void TimeContral::paintEvent(QPaintEvent *event)
     // 绘制时间项
     drawTimeItems(painter);
     
-    // 绘制当前时间气泡
-    if (d->m_showTimeBubble) {
-        drawTimeBubble(painter);
-    }
-    
     // 绘制时间轴上的日期
     if (d->m_showDateOnTimeline) {
         drawDateOnTimeline(painter);
     }
+    
+    d->m_staticLayerDirty = false;
+}
+
+void TimeContral::invalidateStaticLayer()
+{
+    d->m_staticLayerDirty = true;
+    update();
+}
+
+QString TimeContral::timeBubbleText(const QDateTime &time) const
+{
+    return time.toString("yyyy-MM-dd hh") + ":00:00";
+}
+
+QFont TimeContral::timeBubbleFont() const
+{
+    QFont font = this->font();
+    font.setBold(true);
+    font.setPointSize(11);
+    return font;
+}
+
+// 气泡宽度：文本宽度加左右各 10 像素边距；绘制和重绘区域共用，两者不会错开
+int TimeContral::timeBubbleWidth(const QString &text) const
+{
+    QFontMetrics fm(timeBubbleFont());
+    return fm.horizontalAdvance(text) + 20;
+}
+
+QRect TimeContral::currentTimeIndicatorRect(const QDateTime &time) const
+{
+    int currentX = timeToPos(time);
+    int scaleY = height() - 50;
+    
+    // 连接线和刻度上的圆点
+    QRect rect(currentX - 5, 50, 10, scaleY - 50 + 5);
+    
+    // 气泡（与 drawTimeBubble 的布局一致）
+    if (d->m_showTimeBubble) {
+        int bubbleWidth = timeBubbleWidth(timeBubbleText(time));
+        int bubbleX = currentX - bubbleWidth/2;
+        if (bubbleX < 5) bubbleX = 5;
+        if (bubbleX + bubbleWidth > width() - 5) bubbleX = width() - bubbleWidth - 5;
+        rect |= QRect(bubbleX, 10, bubbleWidth, 30 + 8);
+    }
+    
+    // 留出抗锯齿边缘
+    return rect.adjusted(-2, -2, 2, 2);
 }
 
 void TimeContral::drawBackground(QPainter &painter)
@@ -458,20 +562,6 @@ void TimeContral::drawTimeScale(QPainter &painter)
         currentHour = currentHour.addSecs(3600); // 下一个小时
     }
     
-    // 绘制当前时间的高亮指示器（不包括文本）
-    int currentX = timeToPos(d->m_currentTime);
-    
-    // 只有当前时间在可见范围内时才绘制高亮
-    if (currentX >= 0 && currentX <= width()) {
-        // 在精确的当前时间位置绘制指示器
-        painter.setPen(Qt::NoPen);
-        painter.setBrush(QBrush(QColor(180, 220, 50))); // 与气泡相同的绿色
-        painter.drawEllipse(QPoint(currentX, scaleY), 4, 4);
-        
-        // 绘制从气泡到时间轴的连接线
-        painter.setPen(QPen(QColor(180, 220, 50, 100), 1, Qt::DashLine));
-        painter.drawLine(currentX, 50, currentX, scaleY - 5);
-    }
 }
 
 void TimeContral::drawTimeItems(QPainter &painter)
@@ -523,8 +613,21 @@ void TimeContral::drawTimeItems(QPainter &painter)
 
 void TimeContral::drawCurrentTimeIndicator(QPainter &painter)
 {
-    // 这个函数现在由 drawTimeScale 中的高亮部分处理
-    Q_UNUSED(painter);
+    // 当前时间的高亮指示器（不包括文本），作为覆盖层绘制在静态图层之上
+    int scaleY = height() - 50;  // 与 drawTimeScale 中的刻度位置一致
+    int currentX = timeToPos(d->m_currentTime);
+    
+    // 只有当前时间在可见范围内时才绘制高亮
+    if (currentX >= 0 && currentX <= width()) {
+        // 在精确的当前时间位置绘制指示器
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(QBrush(QColor(180, 220, 50))); // 与气泡相同的绿色
+        painter.drawEllipse(QPoint(currentX, scaleY), 4, 4);
+        
+        // 绘制从气泡到时间轴的连接线
+        painter.setPen(QPen(QColor(180, 220, 50, 100), 1, Qt::DashLine));
+        painter.drawLine(currentX, 50, currentX, scaleY - 5);
+    }
 }
 
 void TimeContral::drawTimeBubble(QPainter &painter)
@@ -541,16 +644,10 @@ void TimeContral::drawTimeBubble(QPainter &painter)
     
     // 气泡位置和尺寸
     int y = 10; // 顶部位置
-    QString text = d->m_currentTime.toString("yyyy-MM-dd hh") + ":00:00";
-    
-    QFont font = painter.font();
-    font.setBold(true);
-    font.setPointSize(11);
-    painter.setFont(font);
+    QString text = timeBubbleText(d->m_currentTime);
     
-    QFontMetrics fm(font);
-    int textWidth = fm.width(text) + 20;
-    int bubbleWidth = textWidth;
+    painter.setFont(timeBubbleFont());
+    int bubbleWidth = timeBubbleWidth(text);
     int bubbleHeight = 30;
     
     // 确保气泡不超出边界
@@ -727,7 +824,7 @@ void TimeContral::mouseMoveEvent(QMouseEvent *event)
                 d->m_visibleEndTime = newEnd;
                 
                 emit visibleTimeRangeChanged(d->m_visibleStartTime, d->m_visibleEndTime);
-                update();
+                invalidateStaticLayer();
             } else {
                 // 有限滚动：检查边界
                 if (newStart >= d->m_minTime && newEnd <= d->m_maxTime) {
@@ -735,7 +832,7 @@ void TimeContral::mouseMoveEvent(QMouseEvent *event)
                     d->m_visibleEndTime = newEnd;
                     
                     emit visibleTimeRangeChanged(d->m_visibleStartTime, d->m_visibleEndTime);
-                    update();
+                    invalidateStaticLayer();
                 }
             }
         }
@@ -834,5 +931,5 @@ void TimeContral::resizeEvent(QResizeEvent *event)
 void TimeContral::updateLayout()
 {
     // 在控件大小改变时更新布局
-    update();
+    invalidateStaticLayer();
 }
\ No newline at end of file
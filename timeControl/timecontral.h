@@ -63,6 +63,12 @@ public:
     int timeItemCount() const;
     TimeItem timeItemAt(int index) const;
     
+    // 所有时间项开始时间（自纪元毫秒，升序），可作为播放控件的事件索引
+    QVector<qint64> timeItemStartTimes() const;
+    
+    // 所有时间段的起止时间（自纪元毫秒，按开始时间升序），可作为播放控件的片段播放列表
+    QVector<QPair<qint64, qint64>> timeSpanRanges() const;
+    
     // 设置当前选中的时间项
     void setCurrentTimeItem(int index);
     int currentTimeItem() const;
@@ -126,6 +132,16 @@ private:
     void drawTimeBubble(QPainter &painter);
     void drawDateOnTimeline(QPainter &painter);
     
+    // 静态图层缓存
+    void renderStaticLayer();
+    void invalidateStaticLayer();
+    
+    // 当前时间指示器（覆盖层）
+    QString timeBubbleText(const QDateTime &time) const;
+    QFont timeBubbleFont() const;
+    int timeBubbleWidth(const QString &text) const;
+    QRect currentTimeIndicatorRect(const QDateTime &time) const;
+    
     // 查找时间项
     int findTimeItemAt(const QPoint &pos) const;
     
@@ -0,0 +1,138 @@
+#include "playbackclock.h"
+#include "framedriver.h"
+
+PlaybackClock::PlaybackClock(QObject *parent)
+    : QObject(parent)
+    , m_tickInterval(16)
+    , m_ticking(false)
+{
+}
+
+PlaybackClock::~PlaybackClock()
+{
+}
+
+qint64 PlaybackClock::monotonicTime(qint64 elapsedMs) const
+{
+    return elapsedMs;
+}
+
+bool PlaybackClock::isSystemTimebase() const
+{
+    return false;
+}
+
+void PlaybackClock::setTickInterval(int msecs)
+{
+    if (msecs > 0)
+        m_tickInterval = msecs;
+}
+
+int PlaybackClock::tickInterval() const
+{
+    return m_tickInterval;
+}
+
+void PlaybackClock::setTicking(bool ticking)
+{
+    m_ticking = ticking;
+}
+
+bool PlaybackClock::isTicking() const
+{
+    return m_ticking;
+}
+
+SystemPlaybackClock::SystemPlaybackClock(QObject *parent)
+    : PlaybackClock(parent)
+    , m_lastTickMs(0)
+{
+    // 默认节拍取屏幕刷新周期
+    m_tickInterval = FrameDriver::instance()->frameInterval();
+    m_timer.start();
+}
+
+qint64 SystemPlaybackClock::elapsed() const
+{
+    return m_timer.elapsed();
+}
+
+qint64 SystemPlaybackClock::monotonicTime(qint64 elapsedMs) const
+{
+    return m_timer.msecsSinceReference() + elapsedMs;
+}
+
+bool SystemPlaybackClock::isSystemTimebase() const
+{
+    return true;
+}
+
+void SystemPlaybackClock::setTicking(bool ticking)
+{
+    if (ticking == m_ticking)
+        return;
+
+    m_ticking = ticking;
+    if (!ticking) {
+        FrameDriver::instance()->unsubscribe(this);
+        return;
+    }
+
+    // 挂到全局帧驱动上；节拍间隔大于帧间隔时跳过多余的帧
+    m_lastTickMs = m_timer.elapsed();
+    FrameDriver::instance()->subscribe(this, [this](qint64) {
+        qint64 now = m_timer.elapsed();
+        int tolerance = FrameDriver::instance()->frameInterval() / 2;
+        if (now - m_lastTickMs + tolerance < m_tickInterval)
+            return;
+        m_lastTickMs = now;
+        emit tick();
+    });
+}
+
+VirtualPlaybackClock::VirtualPlaybackClock(QObject *parent)
+    : PlaybackClock(parent)
+    , m_elapsed(0)
+    , m_nextTickMs(m_tickInterval)
+    , m_tickCount(0)
+{
+}
+
+qint64 VirtualPlaybackClock::elapsed() const
+{
+    return m_elapsed;
+}
+
+void VirtualPlaybackClock::setTickInterval(int msecs)
+{
+    if (msecs <= 0)
+        return;
+
+    // 新间隔从当前虚拟时刻重新计起
+    m_tickInterval = msecs;
+    m_nextTickMs = m_elapsed + msecs;
+}
+
+qint64 VirtualPlaybackClock::advance(qint64 msecs)
+{
+    if (msecs <= 0)
+        return 0;
+
+    // 逐个节拍推进，节拍处理函数读到的 elapsed() 恰好是节拍时刻
+    qint64 target = m_elapsed + msecs;
+    qint64 ticks = 0;
+    while (m_nextTickMs <= target) {
+        m_elapsed = m_nextTickMs;
+        m_nextTickMs += m_tickInterval;
+        ++m_tickCount;
+        ++ticks;
+        emit tick();
+    }
+    m_elapsed = target;
+    return ticks;
+}
+
+qint64 VirtualPlaybackClock::tickCount() const
+{
+    return m_tickCount;
+}
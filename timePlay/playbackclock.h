@@ -0,0 +1,92 @@
+#ifndef PLAYBACKCLOCK_H
+#define PLAYBACKCLOCK_H
+
+#include <QObject>
+#include <QElapsedTimer>
+
+/**
+ * @brief 播放时钟源
+ * 
+ * 为播放引擎提供单调时间和刷新节拍。默认使用系统时钟；测试和基准可注入虚拟时钟，
+ * 立即推进虚拟时间并逐个检查节拍
+ */
+class PlaybackClock : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PlaybackClock(QObject *parent = nullptr);
+    ~PlaybackClock() override;
+    
+    // 自时钟起点经过的毫秒数，单调不减
+    virtual qint64 elapsed() const = 0;
+    
+    // 把 elapsed() 时基换算为播放头快照的时基；默认原样返回，即时钟自身的时基
+    virtual qint64 monotonicTime(qint64 elapsedMs) const;
+    
+    // monotonicTime() 是否与 PlayheadPublisher::monotonicNow() 同一时基，
+    // 只有这样读取方才能按系统单调时钟外推
+    virtual bool isSystemTimebase() const;
+    
+    // 节拍间隔（毫秒）
+    virtual void setTickInterval(int msecs);
+    int tickInterval() const;
+    
+    // 播放控件只在播放期间请求节拍
+    virtual void setTicking(bool ticking);
+    bool isTicking() const;
+
+signals:
+    void tick();
+
+protected:
+    int m_tickInterval;
+    bool m_ticking;
+};
+
+/**
+ * @brief 系统时钟源：QElapsedTimer 计时，全局帧驱动提供节拍
+ */
+class SystemPlaybackClock : public PlaybackClock
+{
+    Q_OBJECT
+
+public:
+    explicit SystemPlaybackClock(QObject *parent = nullptr);
+    
+    qint64 elapsed() const override;
+    qint64 monotonicTime(qint64 elapsedMs) const override;
+    bool isSystemTimebase() const override;
+    void setTicking(bool ticking) override;
+
+private:
+    QElapsedTimer m_timer;
+    qint64 m_lastTickMs;
+};
+
+/**
+ * @brief 虚拟时钟源：时间只由 advance() 推进，途经的每个节拍按顺序同步发出
+ * 
+ * 节拍落在 tickInterval 的整数倍上，与是否请求节拍无关，便于断言确定的节拍序列
+ */
+class VirtualPlaybackClock : public PlaybackClock
+{
+    Q_OBJECT
+
+public:
+    explicit VirtualPlaybackClock(QObject *parent = nullptr);
+    
+    qint64 elapsed() const override;
+    void setTickInterval(int msecs) override;
+    
+    // 推进虚拟时间，返回期间发出的节拍数
+    qint64 advance(qint64 msecs);
+    qint64 tickCount() const;
+
+private:
+    qint64 m_elapsed;
+    qint64 m_nextTickMs;
+    qint64 m_tickCount;
+};
+
+#endif // PLAYBACKCLOCK_H
@@ -0,0 +1,92 @@
+#include "playhead.h"
+#include <QElapsedTimer>
+
+double PlayheadSnapshot::mediaTimeAt(qint64 monotonicNowMs) const
+{
+    double media = mediaMs + rate * (monotonicNowMs - monotonicMs);
+    if (startMs < endMs)
+        media = qBound<double>(startMs, media, endMs);
+    return media;
+}
+
+PlayheadPublisher::PlayheadPublisher()
+    : m_version(0)
+    , m_state(0)
+    , m_mediaMs(0)
+    , m_speed(0)
+    , m_rate(0)
+    , m_monotonicMs(0)
+    , m_systemTimebase(false)
+    , m_startMs(0)
+    , m_endMs(0)
+{
+}
+
+void PlayheadPublisher::publish(const PlayheadSnapshot &snapshot)
+{
+    // 先把版本号置为奇数，字段写入不得越过这一步
+    quint64 version = m_version.load(std::memory_order_relaxed);
+    m_version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    m_state.store(snapshot.state, std::memory_order_relaxed);
+    m_mediaMs.store(snapshot.mediaMs, std::memory_order_relaxed);
+    m_speed.store(snapshot.speed, std::memory_order_relaxed);
+    m_rate.store(snapshot.rate, std::memory_order_relaxed);
+    m_monotonicMs.store(snapshot.monotonicMs, std::memory_order_relaxed);
+    m_systemTimebase.store(snapshot.systemTimebase, std::memory_order_relaxed);
+    m_startMs.store(snapshot.startMs, std::memory_order_relaxed);
+    m_endMs.store(snapshot.endMs, std::memory_order_relaxed);
+
+    // 写完后置回偶数，读取方看到新版本号时一定也能看到全部字段
+    m_version.store(version + 2, std::memory_order_release);
+}
+
+PlayheadSnapshot PlayheadPublisher::snapshot() const
+{
+    PlayheadSnapshot result;
+    quint64 before;
+    quint64 after;
+    do {
+        before = m_version.load(std::memory_order_acquire);
+        if (before & 1)
+            continue;
+
+        result.state = m_state.load(std::memory_order_relaxed);
+        result.mediaMs = m_mediaMs.load(std::memory_order_relaxed);
+        result.speed = m_speed.load(std::memory_order_relaxed);
+        result.rate = m_rate.load(std::memory_order_relaxed);
+        result.monotonicMs = m_monotonicMs.load(std::memory_order_relaxed);
+        result.systemTimebase = m_systemTimebase.load(std::memory_order_relaxed);
+        result.startMs = m_startMs.load(std::memory_order_relaxed);
+        result.endMs = m_endMs.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = m_version.load(std::memory_order_relaxed);
+        if (before == after)
+            break;
+    } while (true);
+
+    result.sequence = before / 2;
+    return result;
+}
+
+quint64 PlayheadPublisher::sequence() const
+{
+    return m_version.load(std::memory_order_acquire) / 2;
+}
+
+double PlayheadPublisher::mediaTimeNow() const
+{
+    // 虚拟时钟的采样时刻无法与真实时间比较，按真实时间外推会得到任意偏差
+    PlayheadSnapshot current = snapshot();
+    return current.mediaTimeAt(current.systemTimebase ? monotonicNow() : current.monotonicMs);
+}
+
+qint64 PlayheadPublisher::monotonicNow()
+{
+    // QElapsedTimer 的参考时刻来自单调时钟，可在任意线程读取
+    QElapsedTimer timer;
+    timer.start();
+    return timer.msecsSinceReference();
+}
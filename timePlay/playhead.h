@@ -0,0 +1,71 @@
+#ifndef PLAYHEAD_H
+#define PLAYHEAD_H
+
+#include <QtGlobal>
+#include <atomic>
+
+/**
+ * @brief 播放头快照
+ * 
+ * 某一单调时钟时刻的媒体时间与推进速率，任意线程可据此外推“此刻”的媒体时间
+ */
+struct PlayheadSnapshot
+{
+    quint64 sequence = 0;     // 发布序号，每次发布加一，0 表示尚未发布
+    int state = 0;            // TimePlayControl::PlayState
+    double mediaMs = 0;       // 采样时刻的媒体时间（自纪元毫秒）
+    double speed = 0;         // 播放速度（负值表示倒放）
+    double rate = 0;          // 每单调毫秒推进的媒体毫秒，未播放时为 0
+    qint64 monotonicMs = 0;   // 采样时刻，播放时钟源的时基
+    bool systemTimebase = false; // monotonicMs 是否与 PlayheadPublisher::monotonicNow() 同一时基
+    qint64 startMs = 0;       // 播放范围
+    qint64 endMs = 0;
+
+    bool isValid() const { return sequence != 0; }
+    
+    // 按采样时的速率外推到指定时刻（与 monotonicMs 同一时基），结果限制在播放范围内
+    double mediaTimeAt(qint64 monotonicNowMs) const;
+};
+
+/**
+ * @brief 无锁播放头发布器
+ * 
+ * GUI 线程单写、任意线程多读的顺序锁：读取方不加锁、不等待 GUI 节拍，
+ * 发布过程中读到的撕裂数据会被序号校验发现并重读
+ */
+class PlayheadPublisher
+{
+public:
+    PlayheadPublisher();
+    
+    // 只能由一个线程调用（播放控件所在的 GUI 线程）
+    void publish(const PlayheadSnapshot &snapshot);
+    
+    // 任意线程调用
+    PlayheadSnapshot snapshot() const;
+    quint64 sequence() const;
+    
+    // 按系统单调时钟外推到此刻；注入虚拟时钟时不外推，返回采样时的位置，
+    // 需要外推时用 mediaTimeAt() 传入虚拟时间
+    double mediaTimeNow() const;
+    
+    // 单调时钟当前时间（毫秒）
+    static qint64 monotonicNow();
+
+private:
+    Q_DISABLE_COPY(PlayheadPublisher)
+    
+    // 奇数表示正在写入
+    std::atomic<quint64> m_version;
+    
+    std::atomic<int> m_state;
+    std::atomic<double> m_mediaMs;
+    std::atomic<double> m_speed;
+    std::atomic<double> m_rate;
+    std::atomic<qint64> m_monotonicMs;
+    std::atomic<bool> m_systemTimebase;
+    std::atomic<qint64> m_startMs;
+    std::atomic<qint64> m_endMs;
+};
+
+#endif // PLAYHEAD_H
@@ -1,12 +1,127 @@
 #include "timeplaycontrol.h"
+#include "playbackclock.h"
 #include <QPainter>
 #include <QMouseEvent>
 #include <QPaintEvent>
 #include <QResizeEvent>
+#include <QKeyEvent>
+#include <QFocusEvent>
+#include <QPixmapCache>
 #include <QLinearGradient>
 #include <QRadialGradient>
-#include <QTimer>
 #include <QDebug>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+// 播放速度的绝对值范围，负值表示倒放
+const double kMinPlaySpeed = 0.0001;
+const double kMaxPlaySpeed = 1000000.0;
+
+double boundedPlaySpeed(double speed)
+{
+    double magnitude = qBound(kMinPlaySpeed, std::fabs(speed), kMaxPlaySpeed);
+    return speed < 0 ? -magnitude : magnitude;
+}
+
+// 去掉无效区间，按开始时间排序并合并重叠或相接的区间；结果的开始和结束都是升序
+QVector<QPair<qint64, qint64>> normalizedRanges(const QVector<QPair<qint64, qint64>> &ranges)
+{
+    QVector<QPair<qint64, qint64>> sorted;
+    sorted.reserve(ranges.size());
+    for (const QPair<qint64, qint64> &range : ranges) {
+        if (range.first < range.second)
+            sorted.append(range);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    
+    QVector<QPair<qint64, qint64>> merged;
+    for (const QPair<qint64, qint64> &range : sorted) {
+        if (!merged.isEmpty() && range.first <= merged.last().second) {
+            merged.last().second = qMax(merged.last().second, range.second);
+        } else {
+            merged.append(range);
+        }
+    }
+    return merged;
+}
+
+// 绘制模式的按钮，从左到右排列
+enum TransportButton {
+    StepBackwardButton,
+    PlayPauseButton,
+    StepForwardButton,
+    TransportButtonCount
+};
+
+enum TransportGlyph {
+    StepBackwardGlyph,
+    PlayGlyph,
+    PauseGlyph,
+    StepForwardGlyph,
+    TransportGlyphCount
+};
+
+enum SpriteState {
+    NormalSprite,
+    HoverSprite,
+    PressedSprite,
+    DisabledSprite,
+    SpriteStateCount
+};
+
+const int kNoButton = -1;
+
+// 与样式表模式的按钮尺寸和间距一致
+const int kButtonSize = 50;
+const int kButtonSpacing = 30;
+
+// 按样式表的外观画一个按钮：3px 青色圆环，悬停和按下时边框加深并填充
+QPixmap renderTransportSprite(int glyph, int state, qreal dpr)
+{
+    static const char *const glyphTexts[TransportGlyphCount] = { "‹‹", "▶", "⏸", "››" };
+    
+    QPixmap sprite(QSize(kButtonSize, kButtonSize) * dpr);
+    sprite.setDevicePixelRatio(dpr);
+    sprite.fill(Qt::transparent);
+    
+    QPainter painter(&sprite);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::TextAntialiasing);
+    if (state == DisabledSprite)
+        painter.setOpacity(0.4);
+    
+    bool active = state == HoverSprite || state == PressedSprite;
+    int fillAlpha = state == PressedSprite ? 60 : (state == HoverSprite ? 30 : 0);
+    painter.setPen(QPen(QColor(0, 255, 255, active ? 255 : 200), 3));
+    painter.setBrush(fillAlpha > 0 ? QBrush(QColor(0, 255, 255, fillAlpha)) : QBrush(Qt::NoBrush));
+    painter.drawEllipse(QRectF(1.5, 1.5, kButtonSize - 3, kButtonSize - 3));
+    
+    QFont font = painter.font();
+    font.setPixelSize(18);
+    font.setBold(true);
+    painter.setFont(font);
+    painter.setPen(QColor(0, 255, 255, 255));
+    painter.drawText(QRect(0, 0, kButtonSize, kButtonSize), Qt::AlignCenter, QString(glyphTexts[glyph]));
+    
+    return sprite;
+}
+
+// 贴图放在全局像素缓存里，所有控件共用，每种外观只光栅化一次
+QPixmap transportSprite(int glyph, int state, qreal dpr)
+{
+    QString key = QStringLiteral("TimePlayControl/%1/%2/%3").arg(glyph).arg(state).arg(dpr);
+    QPixmap sprite;
+    if (!QPixmapCache::find(key, &sprite)) {
+        sprite = renderTransportSprite(glyph, state, dpr);
+        QPixmapCache::insert(key, sprite);
+    }
+    return sprite;
+}
+
+} // namespace
 
 // 私有实现类
 class TimePlayControl::Private
@@ -20,14 +135,372 @@ public:
         , endTime(QDateTime::currentDateTime().addSecs(3600))
         , playSpeed(1.0)
         , stepInterval(60)
-        , playTimer(new QTimer(q))
+        , systemClock(new SystemPlaybackClock(q))
+        , clock(systemClock)
+        , refreshIntervalMs(0)
+        , anchorWallMs(0)
+        , anchorMediaMs(0)
+        , positionMs(currentTime.toMSecsSinceEpoch())
+        , stepOriginMs(currentTime.toMSecsSinceEpoch())
+        , currentStepMs(currentTime.toMSecsSinceEpoch())
+        , continuousPlayback(false)
+        , skipGaps(false)
+        , gapThresholdMs(60 * 1000)
+        , gapSpeedFactor(20.0)
+        , gapBoostActive(false)
+        , prefetchLookaheadMs(2000)
+        , prefetchValid(false)
+        , prefetchForward(true)
+        , prefetchOriginMs(0)
+        , prefetchLengthMs(0)
+        , rampTargetSpeed(1.0)
+        , rampDurationMs(0)
+        , segmentLooping(false)
+        , activeSegment(-1)
+        , activeStartMs(0)
+        , activeEndMs(0)
+        , nextSegment(-1)
+        , prevSegment(-1)
+        , playhead(new PlayheadPublisher)
+        , buttonMode(WidgetButtons)
+        , hoveredButton(kNoButton)
+        , pressedButton(kNoButton)
+        , focusedButton(PlayPauseButton)
         , mainLayout(nullptr)
         , stepBackwardButton(nullptr)
         , playPauseButton(nullptr)
         , stepForwardButton(nullptr)
     {
-        playTimer->setInterval(1000); // 1秒更新一次
-        QObject::connect(playTimer, &QTimer::timeout, q, &TimePlayControl::onPlayTimer);
+        // 固定刷新节奏，节拍频率与播放速度无关
+        QObject::connect(clock, &PlaybackClock::tick, q, &TimePlayControl::onPlayTimer);
+        for (int button = 0; button < TransportButtonCount; ++button)
+            buttonSprites[button] = kNoButton;
+    }
+    
+    bool isButtonEnabled(int button) const
+    {
+        switch (button) {
+        case StepBackwardButton:
+            return currentTime > startTime;
+        case StepForwardButton:
+            return currentTime < endTime;
+        default:
+            return true;
+        }
+    }
+    
+    int buttonGlyph(int button) const
+    {
+        switch (button) {
+        case StepBackwardButton:
+            return StepBackwardGlyph;
+        case StepForwardButton:
+            return StepForwardGlyph;
+        default:
+            return playState == Playing ? PauseGlyph : PlayGlyph;
+        }
+    }
+    
+    // 与 QPushButton 一致：按下后移出按钮不再显示按下状态
+    int buttonState(int button) const
+    {
+        if (!isButtonEnabled(button))
+            return DisabledSprite;
+        if (button == hoveredButton)
+            return button == pressedButton ? PressedSprite : HoverSprite;
+        return NormalSprite;
+    }
+    
+    int buttonAt(const QPoint &pos) const
+    {
+        for (int button = 0; button < TransportButtonCount; ++button) {
+            if (buttonRects[button].contains(pos))
+                return button;
+        }
+        return kNoButton;
+    }
+    
+    // 焦点框画在按钮外侧，重绘区域一并包含
+    QRect buttonUpdateRect(int button) const
+    {
+        return buttonRects[button].adjusted(-4, -4, 4, 4);
+    }
+    
+    // 外观变化的按钮才重绘，悬停和节拍中的状态刷新都只涉及一两个按钮
+    void refreshButton(int button)
+    {
+        int sprite = buttonGlyph(button) * SpriteStateCount + buttonState(button);
+        if (sprite != buttonSprites[button]) {
+            buttonSprites[button] = sprite;
+            q->update(buttonUpdateRect(button));
+        }
+    }
+    
+    void setHoveredButton(int button)
+    {
+        if (button == hoveredButton)
+            return;
+        int previous = hoveredButton;
+        hoveredButton = button;
+        if (previous != kNoButton)
+            refreshButton(previous);
+        if (button != kNoButton)
+            refreshButton(button);
+    }
+    
+    void setFocusedButton(int button)
+    {
+        if (button == focusedButton)
+            return;
+        if (q->hasFocus()) {
+            q->update(buttonUpdateRect(focusedButton));
+            q->update(buttonUpdateRect(button));
+        }
+        focusedButton = button;
+    }
+    
+    // 沿 step 方向查找下一个可用按钮，跳过不可用的，没有时返回 kNoButton
+    int nextFocusButton(int from, int step) const
+    {
+        for (int button = from + step; button >= 0 && button < TransportButtonCount; button += step) {
+            if (isButtonEnabled(button))
+                return button;
+        }
+        return kNoButton;
+    }
+    
+    // 离 from 最近的可用按钮，距离相同时取右侧，都不可用时退回播放/暂停按钮
+    int nearestEnabledButton(int from) const
+    {
+        int forward = nextFocusButton(from, 1);
+        int backward = nextFocusButton(from, -1);
+        if (forward != kNoButton && (backward == kNoButton || forward - from <= from - backward))
+            return forward;
+        return backward != kNoButton ? backward : PlayPauseButton;
+    }
+
+    void startTicking()
+    {
+        clock->setTicking(true);
+    }
+
+    void stopTicking()
+    {
+        clock->setTicking(false);
+    }
+
+    // 播放中按旧的映射把精确媒体位置推进到指定墙钟时刻
+    void syncPosition(qint64 wallMs)
+    {
+        if (playState == Playing)
+            positionMs = positionAt(wallMs);
+    }
+
+    // 以指定墙钟时刻和当前精确媒体位置重新建立映射锚点，未完成的变速过程从新锚点继续
+    void resetAnchor(qint64 wallMs)
+    {
+        if (rampDurationMs > 0) {
+            qint64 remaining = rampDurationMs - (wallMs - anchorWallMs);
+            if (remaining > 0) {
+                playSpeed = speedAt(wallMs);
+                rampDurationMs = static_cast<int>(remaining);
+            } else {
+                playSpeed = rampTargetSpeed;
+                rampDurationMs = 0;
+            }
+        }
+        anchorWallMs = wallMs;
+        anchorMediaMs = positionMs;
+    }
+
+    // 速度或步进改变前调用：保留已走过的媒体时间，再从当前时刻重新映射
+    void rebaseClock()
+    {
+        qint64 now = clock->elapsed();
+        syncPosition(now);
+        resetAnchor(now);
+    }
+
+    // 跳转到指定媒体时间，步进网格以跳转位置为原点
+    void seekTo(qint64 mediaMs)
+    {
+        positionMs = mediaMs;
+        stepOriginMs = mediaMs;
+        currentStepMs = mediaMs;
+        resetAnchor(clock->elapsed());
+        if (!segments.isEmpty())
+            locateSegment(mediaMs);
+    }
+
+    // 选中片段并预先算好边界和前后相邻片段，节拍中只需比较
+    void selectSegment(int index)
+    {
+        activeSegment = index;
+        activeStartMs = segments.at(index).first;
+        activeEndMs = segments.at(index).second;
+        int last = segments.size() - 1;
+        nextSegment = index < last ? index + 1 : (segmentLooping ? 0 : -1);
+        prevSegment = index > 0 ? index - 1 : (segmentLooping ? last : -1);
+    }
+
+    // 定位媒体位置所在片段；位于片段之间时边界收缩到该位置，下一个节拍即接入相邻片段
+    void locateSegment(double mediaMs)
+    {
+        auto it = std::upper_bound(segments.constBegin(), segments.constEnd(), mediaMs,
+                                   [](double ms, const QPair<qint64, qint64> &segment) {
+                                       return ms < segment.first;
+                                   });
+        int after = static_cast<int>(it - segments.constBegin());
+        int before = after - 1;
+        if (before >= 0 && mediaMs <= segments.at(before).second) {
+            selectSegment(before);
+            return;
+        }
+
+        int last = segments.size() - 1;
+        activeSegment = -1;
+        activeStartMs = mediaMs;
+        activeEndMs = mediaMs;
+        nextSegment = after <= last ? after : (segmentLooping ? 0 : -1);
+        prevSegment = before >= 0 ? before : (segmentLooping ? last : -1);
+    }
+
+    // 越过当前片段边界后的位置：越界部分带入相邻片段，保持播放节奏连续；
+    // 播放方向上没有相邻片段时返回边界位置并置 finished
+    double crossSegmentBoundary(double position, bool *finished) const
+    {
+        bool forward = position > activeEndMs;
+        int target = forward ? nextSegment : prevSegment;
+        *finished = target < 0;
+        if (*finished)
+            return forward ? activeEndMs : activeStartMs;
+
+        const QPair<qint64, qint64> &segment = segments.at(target);
+        double overshoot = forward ? position - activeEndMs : activeStartMs - position;
+        double entry = forward ? segment.first + overshoot : segment.second - overshoot;
+        return qBound<double>(segment.first, entry, segment.second);
+    }
+
+    // 播放方向上的播放列表是否已播完
+    bool atSegmentsEnd(double direction) const
+    {
+        if (segments.isEmpty())
+            return false;
+        return direction >= 0 ? nextSegment < 0 && positionMs >= activeEndMs
+                              : prevSegment < 0 && positionMs <= activeStartMs;
+    }
+
+    // 某一墙钟时刻的瞬时速度（变速过程中线性插值）
+    double speedAt(qint64 wallMs) const
+    {
+        if (rampDurationMs <= 0)
+            return playSpeed;
+        double t = qMin<double>(wallMs - anchorWallMs, rampDurationMs);
+        return playSpeed + (rampTargetSpeed - playSpeed) * t / rampDurationMs;
+    }
+
+    // 从锚点到某一墙钟时刻的速度积分（速度 × 毫秒）
+    double speedIntegral(qint64 wallMs) const
+    {
+        double dt = wallMs - anchorWallMs;
+        if (rampDurationMs <= 0)
+            return playSpeed * dt;
+
+        double rampDt = qMin<double>(dt, rampDurationMs);
+        double accel = (rampTargetSpeed - playSpeed) / rampDurationMs;
+        double integral = playSpeed * rampDt + 0.5 * accel * rampDt * rampDt;
+        if (dt > rampDt)
+            integral += rampTargetSpeed * (dt - rampDt);
+        return integral;
+    }
+
+    // 墙钟时刻对应的精确媒体时间（毫秒）
+    double positionAt(qint64 wallMs) const
+    {
+        double boost = gapBoostActive ? gapSpeedFactor : 1.0;
+        return anchorMediaMs + speedIntegral(wallMs) * stepInterval * boost;
+    }
+
+    bool hasEventIndex() const
+    {
+        return !eventTimes.isEmpty() || !eventSpans.isEmpty();
+    }
+
+    // 某一媒体位置是否处在空档：不在任何事件时间段内，且与前后最近的事件时刻和
+    // 时间段边界的距离都超过阈值（O(log n)）
+    bool isInEventGap(double mediaMs) const
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+        auto it = std::lower_bound(eventTimes.constBegin(), eventTimes.constEnd(),
+                                   static_cast<qint64>(std::ceil(mediaMs)));
+        double nextDist = it != eventTimes.constEnd() ? *it - mediaMs : infinity;
+        double prevDist = it != eventTimes.constBegin() ? mediaMs - *(it - 1) : infinity;
+        
+        // 时间段已合并，开始时间之前最近的一个时间段是唯一可能包含该位置的时间段
+        auto span = std::upper_bound(eventSpans.constBegin(), eventSpans.constEnd(), mediaMs,
+                                     [](double pos, const QPair<qint64, qint64> &range) {
+                                         return pos < range.first;
+                                     });
+        if (span != eventSpans.constEnd())
+            nextDist = qMin(nextDist, span->first - mediaMs);
+        if (span != eventSpans.constBegin()) {
+            if (mediaMs <= (span - 1)->second)
+                return false;
+            prevDist = qMin(prevDist, mediaMs - (span - 1)->second);
+        }
+        return nextDist > gapThresholdMs && prevDist > gapThresholdMs;
+    }
+
+    // 快进时不能越过的位置：播放方向上下一个事件时刻或时间段前的阈值边界；
+    // 倒放时时间段从结束一侧进入
+    double gapExitPosition(double fromMs, double direction) const
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+        if (direction >= 0) {
+            auto it = std::upper_bound(eventTimes.constBegin(), eventTimes.constEnd(),
+                                       static_cast<qint64>(std::floor(fromMs)));
+            double exitPos = it != eventTimes.constEnd() ? *it - gapThresholdMs : infinity;
+            auto span = std::upper_bound(eventSpans.constBegin(), eventSpans.constEnd(), fromMs,
+                                         [](double pos, const QPair<qint64, qint64> &range) {
+                                             return pos < range.first;
+                                         });
+            if (span != eventSpans.constEnd())
+                exitPos = qMin(exitPos, double(span->first - gapThresholdMs));
+            return exitPos;
+        }
+        auto it = std::lower_bound(eventTimes.constBegin(), eventTimes.constEnd(),
+                                   static_cast<qint64>(std::ceil(fromMs)));
+        double exitPos = it != eventTimes.constBegin() ? *(it - 1) + gapThresholdMs : -infinity;
+        auto span = std::lower_bound(eventSpans.constBegin(), eventSpans.constEnd(), fromMs,
+                                     [](const QPair<qint64, qint64> &range, double pos) {
+                                         return range.second < pos;
+                                     });
+        if (span != eventSpans.constBegin())
+            exitPos = qMax(exitPos, double((span - 1)->second + gapThresholdMs));
+        return exitPos;
+    }
+
+    // 当前有效播放速率：每墙钟毫秒推进的媒体毫秒（带方向，含空档快进倍率）
+    double effectiveRate(qint64 wallMs) const
+    {
+        double boost = gapBoostActive ? gapSpeedFactor : 1.0;
+        return speedAt(wallMs) * stepInterval * boost;
+    }
+
+    // 切换空档快进状态，从给定位置重新建立映射
+    void setGapBoost(bool active, qint64 wallMs, double mediaMs)
+    {
+        positionMs = mediaMs;
+        resetAnchor(wallMs);
+        gapBoostActive = active;
+    }
+
+    // 取最近越过的步进边界：正放向下取整，倒放向上取整
+    qint64 quantizeToStep(double mediaMs, double direction) const
+    {
+        double steps = (mediaMs - stepOriginMs) / (stepInterval * 1000.0);
+        steps = direction < 0 ? std::ceil(steps) : std::floor(steps);
+        return stepOriginMs + static_cast<qint64>(steps) * stepInterval * 1000LL;
     }
 
     TimePlayControl *q;
@@ -40,8 +513,66 @@ public:
     double playSpeed;
     int stepInterval;
     
-    // 定时器
-    QTimer *playTimer;
+    // 时钟源：默认系统时钟，可替换为外部注入的时钟（例如测试用的虚拟时钟）
+    SystemPlaybackClock *systemClock;
+    PlaybackClock *clock;
+    QMetaObject::Connection clockDestroyedConnection;
+    
+    // 用户设置的刷新间隔，切换时钟时应用到新时钟；0 表示沿用时钟自身的默认节拍
+    int refreshIntervalMs;
+    
+    // 墙钟到媒体时间的映射：media = anchorMedia + ∫speed dt / 1000 × stepInterval 秒
+    qint64 anchorWallMs;
+    double anchorMediaMs;
+    
+    // 精确媒体位置与步进网格；连续播放时 currentTime 取精确位置，否则取步进边界
+    double positionMs;
+    qint64 stepOriginMs;
+    qint64 currentStepMs;
+    bool continuousPlayback;
+    
+    // 事件索引（升序，自纪元毫秒）与空档快进；时间段已合并，段内不算空档
+    QVector<qint64> eventTimes;
+    QVector<QPair<qint64, qint64>> eventSpans;
+    bool skipGaps;
+    qint64 gapThresholdMs;
+    double gapSpeedFactor;
+    bool gapBoostActive;
+    
+    // 预取窗口：从发布位置沿播放方向覆盖 lookahead 墙钟毫秒内将播放的媒体时间
+    int prefetchLookaheadMs;
+    bool prefetchValid;
+    bool prefetchForward;
+    double prefetchOriginMs;
+    double prefetchLengthMs;
+    QDateTime prefetchFrom;
+    QDateTime prefetchTo;
+    
+    // 变速过程：从锚点起 rampDurationMs 毫秒内由 playSpeed 线性过渡到 rampTargetSpeed
+    double rampTargetSpeed;
+    int rampDurationMs;
+    
+    // 片段播放列表（按开始时间排序、互不重叠，已裁剪到播放范围内）；-1 表示不在任何
+    // 片段内或没有相邻片段。requestedSegments 保留裁剪前的列表，播放范围变化时重新裁剪
+    QVector<QPair<qint64, qint64>> requestedSegments;
+    QVector<QPair<qint64, qint64>> segments;
+    bool segmentLooping;
+    int activeSegment;
+    double activeStartMs;
+    double activeEndMs;
+    int nextSegment;
+    int prevSegment;
+    
+    // 跨线程发布的播放头
+    QSharedPointer<PlayheadPublisher> playhead;
+    
+    // 绘制模式的按钮：点击区域、最近一次绘制的贴图编号、悬停/按下/键盘焦点所在按钮
+    ButtonMode buttonMode;
+    QRect buttonRects[TransportButtonCount];
+    int buttonSprites[TransportButtonCount];
+    int hoveredButton;
+    int pressedButton;
+    int focusedButton;
     
     // UI组件
     QHBoxLayout *mainLayout;
@@ -51,22 +582,66 @@ public:
 };
 
 TimePlayControl::TimePlayControl(QWidget *parent)
+    : TimePlayControl(WidgetButtons, parent)
+{
+}
+
+TimePlayControl::TimePlayControl(ButtonMode mode, QWidget *parent)
     : QWidget(parent)
     , d(new Private(this))
 {
+    d->buttonMode = mode;
     setMinimumSize(300, 80);
     setMaximumHeight(100);
     setupUI();
     updateButtonStates();
+    publishPlayhead();
 }
 
 TimePlayControl::~TimePlayControl()
 {
+    // 发布器由读取方共享，可能比控件存活更久：以当前位置留下速率为 0 的停止快照，
+    // 读取方不会在控件销毁后继续外推
+    if (d->playState == Playing) {
+        d->syncPosition(d->clock->elapsed());
+        d->stopTicking();
+    }
+    d->playState = Stopped;
+    publishPlayhead();
     delete d;
 }
 
+void TimePlayControl::setButtonMode(ButtonMode mode)
+{
+    if (d->buttonMode == mode)
+        return;
+    
+    clearButtons();
+    d->buttonMode = mode;
+    setupUI();
+    updateButtonStates();
+    update();
+}
+
+TimePlayControl::ButtonMode TimePlayControl::buttonMode() const
+{
+    return d->buttonMode;
+}
+
 void TimePlayControl::setupUI()
 {
+    if (d->buttonMode == PaintedButtons) {
+        // 不创建子控件和样式表，按钮只是 paintEvent 中的点击区域；
+        // 控件自身接收焦点，Tab 和左右方向键在三个按钮间移动
+        setMouseTracking(true);
+        setFocusPolicy(Qt::StrongFocus);
+        layoutPaintedButtons();
+        return;
+    }
+    
+    setMouseTracking(false);
+    setFocusPolicy(Qt::NoFocus);
+    
     // 创建主布局
     d->mainLayout = new QHBoxLayout(this);
     d->mainLayout->setContentsMargins(20, 15, 20, 15);
@@ -98,6 +673,75 @@ void TimePlayControl::setupUI()
     d->mainLayout->addStretch();
 }
 
+void TimePlayControl::clearButtons()
+{
+    // 布局不拥有按钮，按钮需单独删除
+    delete d->mainLayout;
+    delete d->stepBackwardButton;
+    delete d->playPauseButton;
+    delete d->stepForwardButton;
+    d->mainLayout = nullptr;
+    d->stepBackwardButton = nullptr;
+    d->playPauseButton = nullptr;
+    d->stepForwardButton = nullptr;
+    
+    d->hoveredButton = kNoButton;
+    d->pressedButton = kNoButton;
+    for (int button = 0; button < TransportButtonCount; ++button)
+        d->buttonSprites[button] = kNoButton;
+}
+
+void TimePlayControl::layoutPaintedButtons()
+{
+    // 与样式表模式的布局一致：边距 20/15 的内容区内水平、垂直居中
+    QRect contents = rect().adjusted(20, 15, -20, -15);
+    int total = TransportButtonCount * kButtonSize + (TransportButtonCount - 1) * kButtonSpacing;
+    int x = contents.left() + (contents.width() - total) / 2;
+    int y = contents.top() + (contents.height() - kButtonSize) / 2;
+    for (int button = 0; button < TransportButtonCount; ++button) {
+        d->buttonRects[button] = QRect(x + button * (kButtonSize + kButtonSpacing), y,
+                                       kButtonSize, kButtonSize);
+    }
+}
+
+void TimePlayControl::activatePaintedButton(int button)
+{
+    switch (button) {
+    case StepBackwardButton:
+        onStepBackwardClicked();
+        break;
+    case PlayPauseButton:
+        onPlayButtonClicked();
+        break;
+    case StepForwardButton:
+        onStepForwardClicked();
+        break;
+    default:
+        break;
+    }
+}
+
+void TimePlayControl::drawPaintedButtons(QPainter &painter, const QRect &dirtyRect)
+{
+    qreal dpr = devicePixelRatioF();
+    for (int button = 0; button < TransportButtonCount; ++button) {
+        if (!dirtyRect.intersects(d->buttonUpdateRect(button)))
+            continue;
+        
+        int glyph = d->buttonGlyph(button);
+        int state = d->buttonState(button);
+        d->buttonSprites[button] = glyph * SpriteStateCount + state;
+        painter.drawPixmap(d->buttonRects[button].topLeft(), transportSprite(glyph, state, dpr));
+        
+        // 键盘焦点框
+        if (button == d->focusedButton && hasFocus()) {
+            painter.setBrush(Qt::NoBrush);
+            painter.setPen(QPen(QColor(255, 255, 255, 180), 1.5, Qt::DotLine));
+            painter.drawEllipse(QRectF(d->buttonRects[button]).adjusted(-2.5, -2.5, 2.5, 2.5));
+        }
+    }
+}
+
 void TimePlayControl::createCircularButton(QPushButton *button, const QString &iconText)
 {
     button->setText(iconText);
@@ -124,19 +768,38 @@ void TimePlayControl::createCircularButton(QPushButton *button, const QString &i
 void TimePlayControl::play()
 {
     if (d->playState != Playing) {
+        // 播放列表已播完时从播放方向上的第一个片段重新开始；入口限制在播放范围内，
+        // 且即使与当前时间相同也重新定位片段，否则会立刻再次停在边界
+        if (d->atSegmentsEnd(d->playSpeed)) {
+            qint64 entry = d->playSpeed >= 0 ? d->segments.first().first : d->segments.last().second;
+            entry = qBound(d->startTime.toMSecsSinceEpoch(), entry, d->endTime.toMSecsSinceEpoch());
+            int previousSegment = d->activeSegment;
+            d->currentTime = QDateTime::fromMSecsSinceEpoch(entry);
+            d->seekTo(entry);
+            emit currentTimeChanged(d->currentTime);
+            emit currentStepChanged(d->currentTime);
+            if (d->activeSegment != previousSegment) {
+                emit segmentChanged(d->activeSegment);
+            }
+        }
         d->playState = Playing;
-        d->playTimer->start();
+        d->resetAnchor(d->clock->elapsed());
+        d->startTicking();
         updateButtonStates();
         emit playStateChanged(d->playState);
         emit playClicked();
+        updatePrefetchWindow();
+        publishPlayhead();
     }
 }
 
 void TimePlayControl::pause()
 {
     if (d->playState == Playing) {
+        d->syncPosition(d->clock->elapsed());
         d->playState = Paused;
-        d->playTimer->stop();
+        d->stopTicking();
+        publishPlayhead();
         updateButtonStates();
         emit playStateChanged(d->playState);
         emit pauseClicked();
@@ -147,18 +810,26 @@ void TimePlayControl::stop()
 {
     if (d->playState != Stopped) {
         d->playState = Stopped;
-        d->playTimer->stop();
+        d->stopTicking();
+        int previousSegment = d->activeSegment;
         d->currentTime = d->startTime;
+        d->seekTo(d->startTime.toMSecsSinceEpoch());
+        if (d->activeSegment != previousSegment) {
+            emit segmentChanged(d->activeSegment);
+        }
         updateButtonStates();
         emit playStateChanged(d->playState);
         emit currentTimeChanged(d->currentTime);
+        emit currentStepChanged(d->currentTime);
         emit stopClicked();
+        updatePrefetchWindow();
+        publishPlayhead();
     }
 }
 
 void TimePlayControl::stepForward()
 {
-    QDateTime newTime = d->currentTime.addSecs(d->stepInterval);
+    QDateTime newTime = currentStepTime().addSecs(d->stepInterval);
     if (newTime <= d->endTime) {
         setCurrentTime(newTime);
         emit stepForwardClicked();
@@ -167,7 +838,7 @@ void TimePlayControl::stepForward()
 
 void TimePlayControl::stepBackward()
 {
-    QDateTime newTime = d->currentTime.addSecs(-d->stepInterval);
+    QDateTime newTime = currentStepTime().addSecs(-d->stepInterval);
     if (newTime >= d->startTime) {
         setCurrentTime(newTime);
         emit stepBackwardClicked();
@@ -187,8 +858,17 @@ bool TimePlayControl::isPlaying() const
 void TimePlayControl::setCurrentTime(const QDateTime &time)
 {
     if (time != d->currentTime && time >= d->startTime && time <= d->endTime) {
+        int previousSegment = d->activeSegment;
         d->currentTime = time;
+        // 跳转后以新位置为步进原点；播放中同时重新建立映射锚点
+        d->seekTo(time.toMSecsSinceEpoch());
+        publishPlayhead();
         emit currentTimeChanged(d->currentTime);
+        emit currentStepChanged(d->currentTime);
+        if (d->activeSegment != previousSegment) {
+            emit segmentChanged(d->activeSegment);
+        }
+        updatePrefetchWindow();
     }
 }
 
@@ -197,11 +877,293 @@ QDateTime TimePlayControl::currentTime() const
     return d->currentTime;
 }
 
+QDateTime TimePlayControl::currentStepTime() const
+{
+    return QDateTime::fromMSecsSinceEpoch(d->currentStepMs);
+}
+
+void TimePlayControl::setEventTimes(const QVector<qint64> &msecsSinceEpoch)
+{
+    d->eventTimes = msecsSinceEpoch;
+    if (!std::is_sorted(d->eventTimes.constBegin(), d->eventTimes.constEnd())) {
+        std::sort(d->eventTimes.begin(), d->eventTimes.end());
+    }
+}
+
+QVector<qint64> TimePlayControl::eventTimes() const
+{
+    return d->eventTimes;
+}
+
+void TimePlayControl::setEventSpans(const QVector<QPair<qint64, qint64>> &msecsSinceEpoch)
+{
+    d->eventSpans = normalizedRanges(msecsSinceEpoch);
+}
+
+QVector<QPair<qint64, qint64>> TimePlayControl::eventSpans() const
+{
+    return d->eventSpans;
+}
+
+bool TimePlayControl::seekToNextEvent()
+{
+    qint64 pos = d->currentTime.toMSecsSinceEpoch();
+    auto it = std::upper_bound(d->eventTimes.constBegin(), d->eventTimes.constEnd(), pos);
+    if (it == d->eventTimes.constEnd())
+        return false;
+
+    QDateTime eventTime = QDateTime::fromMSecsSinceEpoch(*it);
+    if (eventTime > d->endTime)
+        return false;
+
+    setCurrentTime(eventTime);
+    return true;
+}
+
+bool TimePlayControl::seekToPreviousEvent()
+{
+    qint64 pos = d->currentTime.toMSecsSinceEpoch();
+    auto it = std::lower_bound(d->eventTimes.constBegin(), d->eventTimes.constEnd(), pos);
+    if (it == d->eventTimes.constBegin())
+        return false;
+
+    QDateTime eventTime = QDateTime::fromMSecsSinceEpoch(*(it - 1));
+    if (eventTime < d->startTime)
+        return false;
+
+    setCurrentTime(eventTime);
+    return true;
+}
+
+void TimePlayControl::setSegments(const QVector<QPair<qint64, qint64>> &msecsSinceEpoch)
+{
+    // 去掉无效片段，按开始时间排序并合并重叠或相接的片段
+    d->requestedSegments = normalizedRanges(msecsSinceEpoch);
+    applySegments();
+}
+
+void TimePlayControl::applySegments()
+{
+    // 片段裁剪到播放范围内，完全落在范围外的片段丢弃，跨片段跳转不会越出播放范围
+    qint64 rangeStart = d->startTime.toMSecsSinceEpoch();
+    qint64 rangeEnd = d->endTime.toMSecsSinceEpoch();
+    QVector<QPair<qint64, qint64>> clipped;
+    clipped.reserve(d->requestedSegments.size());
+    for (const QPair<qint64, qint64> &segment : d->requestedSegments) {
+        qint64 first = qMax(segment.first, rangeStart);
+        qint64 second = qMin(segment.second, rangeEnd);
+        if (first < second)
+            clipped.append(qMakePair(first, second));
+    }
+    
+    int previousSegment = d->activeSegment;
+    d->syncPosition(d->clock->elapsed());
+    d->segments = clipped;
+    if (d->segments.isEmpty()) {
+        d->activeSegment = -1;
+    } else {
+        d->locateSegment(d->positionMs);
+    }
+    if (d->activeSegment != previousSegment) {
+        emit segmentChanged(d->activeSegment);
+    }
+}
+
+QVector<QPair<qint64, qint64>> TimePlayControl::segments() const
+{
+    return d->segments;
+}
+
+void TimePlayControl::clearSegments()
+{
+    setSegments(QVector<QPair<qint64, qint64>>());
+}
+
+int TimePlayControl::currentSegment() const
+{
+    return d->activeSegment;
+}
+
+void TimePlayControl::setSegmentLooping(bool enabled)
+{
+    if (d->segmentLooping == enabled)
+        return;
+
+    d->segmentLooping = enabled;
+    if (d->activeSegment >= 0) {
+        d->selectSegment(d->activeSegment);
+    } else if (!d->segments.isEmpty()) {
+        d->syncPosition(d->clock->elapsed());
+        d->locateSegment(d->positionMs);
+    }
+}
+
+bool TimePlayControl::isSegmentLooping() const
+{
+    return d->segmentLooping;
+}
+
+void TimePlayControl::setLoopRange(const QDateTime &a, const QDateTime &b)
+{
+    if (!a.isValid() || !b.isValid() || a == b)
+        return;
+
+    QVector<QPair<qint64, qint64>> loop;
+    loop.append(qMakePair(qMin(a, b).toMSecsSinceEpoch(), qMax(a, b).toMSecsSinceEpoch()));
+    setSegmentLooping(true);
+    setSegments(loop);
+}
+
+void TimePlayControl::setSkipGapsEnabled(bool enabled)
+{
+    if (d->skipGaps == enabled)
+        return;
+
+    if (!enabled && d->gapBoostActive) {
+        // 以快进倍率结算已走过的位置后退出快进
+        qint64 now = d->clock->elapsed();
+        d->syncPosition(now);
+        d->setGapBoost(false, now, d->positionMs);
+        publishPlayhead();
+        emit gapSkippingChanged(false);
+    }
+    d->skipGaps = enabled;
+}
+
+bool TimePlayControl::isSkipGapsEnabled() const
+{
+    return d->skipGaps;
+}
+
+void TimePlayControl::setGapThreshold(int seconds)
+{
+    if (seconds > 0) {
+        d->gapThresholdMs = seconds * 1000LL;
+    }
+}
+
+int TimePlayControl::gapThreshold() const
+{
+    return static_cast<int>(d->gapThresholdMs / 1000);
+}
+
+void TimePlayControl::setGapSpeedFactor(double factor)
+{
+    if (factor < 1.0)
+        return;
+
+    if (d->gapBoostActive) {
+        d->rebaseClock();
+    }
+    d->gapSpeedFactor = factor;
+    if (d->gapBoostActive) {
+        publishPlayhead();
+    }
+}
+
+double TimePlayControl::gapSpeedFactor() const
+{
+    return d->gapSpeedFactor;
+}
+
+void TimePlayControl::setPrefetchLookahead(int msecs)
+{
+    if (msecs > 0) {
+        d->prefetchLookaheadMs = msecs;
+        updatePrefetchWindow();
+    }
+}
+
+int TimePlayControl::prefetchLookahead() const
+{
+    return d->prefetchLookaheadMs;
+}
+
+QDateTime TimePlayControl::prefetchWindowStart() const
+{
+    return d->prefetchFrom;
+}
+
+QDateTime TimePlayControl::prefetchWindowEnd() const
+{
+    return d->prefetchTo;
+}
+
+void TimePlayControl::updatePrefetchWindow()
+{
+    double rate = d->effectiveRate(d->clock->elapsed());
+    bool forward = rate >= 0;
+    double position = d->positionMs;
+    
+    // 窗口长度：lookahead 内将播放的媒体时间，至少一个步进间隔
+    double length = qMax(std::fabs(rate) * d->prefetchLookaheadMs, d->stepInterval * 1000.0);
+    
+    // 滞回：方向不变、播放头仍在窗口前半段、所需长度在已发布长度的 1/4～2 倍之间时不重新发布
+    if (d->prefetchValid && forward == d->prefetchForward) {
+        double travelled = forward ? position - d->prefetchOriginMs : d->prefetchOriginMs - position;
+        bool sizeOk = length <= d->prefetchLengthMs * 2 && length >= d->prefetchLengthMs / 4;
+        if (travelled >= 0 && travelled <= d->prefetchLengthMs / 2 && sizeOk)
+            return;
+    }
+    
+    double fromMs = forward ? position : position - length;
+    double toMs = forward ? position + length : position;
+    QDateTime from = qMax(QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(fromMs)), d->startTime);
+    QDateTime to = qMin(QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(toMs)), d->endTime);
+    
+    d->prefetchValid = true;
+    d->prefetchForward = forward;
+    d->prefetchOriginMs = position;
+    d->prefetchLengthMs = length;
+    d->prefetchFrom = from;
+    d->prefetchTo = to;
+    emit prefetchWindowChanged(from, to);
+}
+
+void TimePlayControl::publishPlayhead()
+{
+    // 采样此刻的精确位置与瞬时速率，读取方据此自行外推
+    qint64 wallNow = d->clock->elapsed();
+    bool playing = d->playState == Playing;
+    
+    PlayheadSnapshot snapshot;
+    snapshot.state = d->playState;
+    snapshot.mediaMs = playing ? d->positionAt(wallNow) : d->positionMs;
+    snapshot.speed = playing ? d->speedAt(wallNow) : d->playSpeed;
+    snapshot.rate = playing ? d->effectiveRate(wallNow) : 0.0;
+    snapshot.monotonicMs = d->clock->monotonicTime(wallNow);
+    snapshot.systemTimebase = d->clock->isSystemTimebase();
+    snapshot.startMs = d->startTime.toMSecsSinceEpoch();
+    snapshot.endMs = d->endTime.toMSecsSinceEpoch();
+    d->playhead->publish(snapshot);
+}
+
+QSharedPointer<const PlayheadPublisher> TimePlayControl::playheadPublisher() const
+{
+    return d->playhead;
+}
+
+PlayheadSnapshot TimePlayControl::playheadSnapshot() const
+{
+    return d->playhead->snapshot();
+}
+
+void TimePlayControl::setContinuousPlayback(bool enabled)
+{
+    d->continuousPlayback = enabled;
+}
+
+bool TimePlayControl::isContinuousPlayback() const
+{
+    return d->continuousPlayback;
+}
+
 void TimePlayControl::setTimeRange(const QDateTime &startTime, const QDateTime &endTime)
 {
     if (startTime < endTime) {
         d->startTime = startTime;
         d->endTime = endTime;
+        applySegments();
         
         // 确保当前时间在范围内
         if (d->currentTime < d->startTime) {
@@ -209,6 +1171,7 @@ void TimePlayControl::setTimeRange(const QDateTime &startTime, const QDateTime &
         } else if (d->currentTime > d->endTime) {
             setCurrentTime(d->endTime);
         }
+        publishPlayhead();
     }
 }
 
@@ -224,29 +1187,113 @@ QDateTime TimePlayControl::endTime() const
 
 void TimePlayControl::setPlaySpeed(double speed)
 {
-    if (speed > 0) {
-        d->playSpeed = speed;
-        // 更新定时器间隔 - 支持慢速播放
-        int interval;
-        if (speed >= 1.0) {
-            interval = static_cast<int>(1000 / speed);
-        } else {
-            // 对于小于1的速度，增加间隔时间
-            interval = static_cast<int>(1000 / speed);
-        }
-        d->playTimer->setInterval(interval);
+    if (qFuzzyIsNull(speed))
+        return;
+
+    // 速度改变后从当前位置重新映射，已走过的时间不受新速度影响
+    if (d->playState == Playing) {
+        d->rebaseClock();
     }
+    d->rampDurationMs = 0;
+    d->playSpeed = boundedPlaySpeed(speed);
+    publishPlayhead();
+    emit playSpeedChanged(d->playSpeed);
+    updatePrefetchWindow();
 }
 
 double TimePlayControl::playSpeed() const
 {
+    if (d->playState == Playing) {
+        return d->speedAt(d->clock->elapsed());
+    }
     return d->playSpeed;
 }
 
+void TimePlayControl::rampPlaySpeed(double targetSpeed, int durationMs)
+{
+    if (qFuzzyIsNull(targetSpeed))
+        return;
+
+    if (d->playState != Playing || durationMs <= 0) {
+        setPlaySpeed(targetSpeed);
+        return;
+    }
+
+    // 从当前瞬时速度开始线性过渡，媒体时间按速度积分推进
+    d->rebaseClock();
+    d->rampTargetSpeed = boundedPlaySpeed(targetSpeed);
+    d->rampDurationMs = durationMs;
+    publishPlayhead();
+}
+
+void TimePlayControl::setRefreshInterval(int msecs)
+{
+    if (msecs > 0) {
+        d->refreshIntervalMs = msecs;
+        d->clock->setTickInterval(msecs);
+    }
+}
+
+int TimePlayControl::refreshInterval() const
+{
+    return d->clock->tickInterval();
+}
+
+void TimePlayControl::setClockSource(PlaybackClock *clock)
+{
+    PlaybackClock *next = clock ? clock : d->systemClock;
+    if (next == d->clock)
+        return;
+
+    // 用旧时钟结算已走过的媒体时间，再在新时钟的当前时刻建立锚点，位置和变速进度保持连续
+    bool playing = d->playState == Playing;
+    d->rebaseClock();
+    if (playing) {
+        d->stopTicking();
+    }
+    QObject::disconnect(d->clock, &PlaybackClock::tick, this, &TimePlayControl::onPlayTimer);
+    QObject::disconnect(d->clockDestroyedConnection);
+    
+    d->clock = next;
+    if (d->refreshIntervalMs > 0) {
+        next->setTickInterval(d->refreshIntervalMs);
+    }
+    d->anchorWallMs = next->elapsed();
+    connect(next, &PlaybackClock::tick, this, &TimePlayControl::onPlayTimer);
+    if (next != d->systemClock) {
+        // 外部时钟先于控件销毁时退回系统时钟；此时外部时钟已不可访问，只能从当前位置重新开始映射
+        d->clockDestroyedConnection = connect(next, &QObject::destroyed, this, [this]() {
+            d->clock = d->systemClock;
+            if (d->refreshIntervalMs > 0) {
+                d->clock->setTickInterval(d->refreshIntervalMs);
+            }
+            connect(d->clock, &PlaybackClock::tick, this, &TimePlayControl::onPlayTimer);
+            d->anchorWallMs = d->clock->elapsed();
+            d->anchorMediaMs = d->positionMs;
+            if (d->playState == Playing) {
+                d->startTicking();
+            }
+        });
+    }
+    if (playing) {
+        d->startTicking();
+    }
+    publishPlayhead();
+}
+
+PlaybackClock *TimePlayControl::clockSource() const
+{
+    return d->clock;
+}
+
 void TimePlayControl::setStepInterval(int seconds)
 {
     if (seconds > 0) {
+        if (d->playState == Playing) {
+            d->rebaseClock();
+        }
         d->stepInterval = seconds;
+        publishPlayhead();
     }
 }
 
@@ -277,12 +1324,79 @@ void TimePlayControl::onStepForwardClicked()
 void TimePlayControl::onPlayTimer()
 {
     if (d->playState == Playing) {
-        // 每次定时器触发时前进一个步进间隔
-        QDateTime newTime = d->currentTime.addSecs(d->stepInterval);
-        if (newTime <= d->endTime) {
-            setCurrentTime(newTime);
+        // 由墙钟计算应到达的媒体时间；定时器迟到或事件循环卡顿时直接跳到正确位置，
+        // 错过的节拍不再补放，因此误差不会累积。节拍频率固定，每个节拍推进的
+        // 媒体时间由速度决定，CPU 占用与播放速度无关
+        qint64 wallNow = d->clock->elapsed();
+        double position = d->positionAt(wallNow);
+        
+        // 自适应播放：远离事件的空档按倍率快进，接近事件时恢复正常速度
+        if (d->skipGaps && d->hasEventIndex()) {
+            double direction = d->speedAt(wallNow);
+            if (d->gapBoostActive) {
+                double exitPos = d->gapExitPosition(d->positionMs, direction);
+                bool passed = direction >= 0 ? position >= exitPos : position <= exitPos;
+                if (passed || !d->isInEventGap(position)) {
+                    if (passed)
+                        position = exitPos;
+                    d->setGapBoost(false, wallNow, position);
+                    emit gapSkippingChanged(false);
+                }
+            } else if (d->isInEventGap(position)) {
+                d->setGapBoost(true, wallNow, position);
+                emit gapSkippingChanged(true);
+            }
+        }
+        
+        // 片段播放：越过当前片段边界时在本节拍内接到相邻片段，不经过停止和重新播放
+        if (!d->segments.isEmpty() && (position > d->activeEndMs || position < d->activeStartMs)) {
+            int previousSegment = d->activeSegment;
+            bool finished = false;
+            position = d->crossSegmentBoundary(position, &finished);
+            d->seekTo(static_cast<qint64>(std::floor(position)));
+            
+            // 新片段的入口即新的步进原点
+            QDateTime entryTime = QDateTime::fromMSecsSinceEpoch(d->currentStepMs);
+            emit currentStepChanged(entryTime);
+            if (d->activeSegment != previousSegment) {
+                emit segmentChanged(d->activeSegment);
+            }
+            if (finished) {
+                // 播放列表结束且未循环：停在边界，保留位置以便回看
+                if (entryTime != d->currentTime) {
+                    d->currentTime = entryTime;
+                    emit currentTimeChanged(d->currentTime);
+                }
+                pause();
+                return;
+            }
+            position = d->positionMs;
+        }
+        
+        qint64 stepMs = d->quantizeToStep(position, d->speedAt(wallNow));
+        qint64 displayMs = d->continuousPlayback ? static_cast<qint64>(std::floor(position)) : stepMs;
+        QDateTime newTime = QDateTime::fromMSecsSinceEpoch(displayMs);
+        if (newTime >= d->startTime && newTime <= d->endTime) {
+            d->positionMs = position;
+            if (newTime != d->currentTime) {
+                d->currentTime = newTime;
+                emit currentTimeChanged(d->currentTime);
+            }
+            // 越过步进边界时发出粗粒度信号，连续播放时供只关心离散事件的使用方
+            if (stepMs != d->currentStepMs) {
+                d->currentStepMs = stepMs;
+                emit currentStepChanged(QDateTime::fromMSecsSinceEpoch(stepMs));
+            }
+            updatePrefetchWindow();
+            // 变速过程结束后固定为目标速度
+            if (d->rampDurationMs > 0 && wallNow - d->anchorWallMs >= d->rampDurationMs) {
+                d->resetAnchor(wallNow);
+                emit playSpeedChanged(d->playSpeed);
+            }
+            // 每个节拍重新发布，变速和空档快进期间读取方的外推误差不超过一个节拍
+            publishPlayhead();
         } else {
-            // 到达结束时间，停止播放
+            // 到达结束时间（倒放时为开始时间），停止播放
             stop();
         }
     }
@@ -290,6 +1404,16 @@ void TimePlayControl::onPlayTimer()
 
 void TimePlayControl::updateButtonStates()
 {
+    // 绘制模式只重绘外观有变化的按钮
+    if (d->buttonMode == PaintedButtons) {
+        for (int button = 0; button < TransportButtonCount; ++button)
+            d->refreshButton(button);
+        // 焦点所在按钮变为不可用时（例如到达结束时间后的前进按钮）移到最近的可用按钮
+        if (!d->isButtonEnabled(d->focusedButton))
+            d->setFocusedButton(d->nearestEnabledButton(d->focusedButton));
+        return;
+    }
+    
     // 更新播放/暂停按钮图标
     if (d->playState == Playing) {
         d->playPauseButton->setText("⏸");
@@ -304,12 +1428,12 @@ void TimePlayControl::updateButtonStates()
 
 void TimePlayControl::paintEvent(QPaintEvent *event)
 {
-    Q_UNUSED(event);
-    
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
     
     drawBackground(painter);
+    if (d->buttonMode == PaintedButtons)
+        drawPaintedButtons(painter, event->rect());
 }
 
 void TimePlayControl::drawBackground(QPainter &painter)
@@ -340,6 +1464,109 @@ void TimePlayControl::drawBackground(QPainter &painter)
 
 void TimePlayControl::resizeEvent(QResizeEvent *event)
 {
-    Q_UNUSED(event);
+    if (d->buttonMode == PaintedButtons)
+        layoutPaintedButtons();
     QWidget::resizeEvent(event);
+}
+
+void TimePlayControl::mousePressEvent(QMouseEvent *event)
+{
+    if (d->buttonMode == PaintedButtons && event->button() == Qt::LeftButton) {
+        int button = d->buttonAt(event->pos());
+        if (button != kNoButton && d->isButtonEnabled(button)) {
+            d->pressedButton = button;
+            d->setHoveredButton(button);
+            d->setFocusedButton(button);
+            d->refreshButton(button);
+            return;
+        }
+    }
+    QWidget::mousePressEvent(event);
+}
+
+void TimePlayControl::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (d->buttonMode == PaintedButtons && event->button() == Qt::LeftButton
+        && d->pressedButton != kNoButton) {
+        int button = d->pressedButton;
+        d->pressedButton = kNoButton;
+        d->refreshButton(button);
+        
+        // 与 QPushButton 一致：在按钮内松开才算点击
+        if (d->buttonAt(event->pos()) == button && d->isButtonEnabled(button))
+            activatePaintedButton(button);
+        return;
+    }
+    QWidget::mouseReleaseEvent(event);
+}
+
+void TimePlayControl::mouseMoveEvent(QMouseEvent *event)
+{
+    if (d->buttonMode == PaintedButtons)
+        d->setHoveredButton(d->buttonAt(event->pos()));
+    QWidget::mouseMoveEvent(event);
+}
+
+void TimePlayControl::leaveEvent(QEvent *event)
+{
+    if (d->buttonMode == PaintedButtons)
+        d->setHoveredButton(kNoButton);
+    QWidget::leaveEvent(event);
+}
+
+void TimePlayControl::keyPressEvent(QKeyEvent *event)
+{
+    if (d->buttonMode == PaintedButtons) {
+        switch (event->key()) {
+        case Qt::Key_Left:
+        case Qt::Key_Right: {
+            int button = d->nextFocusButton(d->focusedButton, event->key() == Qt::Key_Left ? -1 : 1);
+            if (button != kNoButton)
+                d->setFocusedButton(button);
+            return;
+        }
+        case Qt::Key_Space:
+        case Qt::Key_Return:
+        case Qt::Key_Enter:
+            if (!event->isAutoRepeat() && d->isButtonEnabled(d->focusedButton))
+                activatePaintedButton(d->focusedButton);
+            return;
+        default:
+            break;
+        }
+    }
+    QWidget::keyPressEvent(event);
+}
+
+void TimePlayControl::focusInEvent(QFocusEvent *event)
+{
+    if (d->buttonMode == PaintedButtons) {
+        // Tab 进入时落在第一个可用按钮，Shift+Tab 进入时落在最后一个
+        if (event->reason() == Qt::TabFocusReason)
+            d->setFocusedButton(d->nextFocusButton(-1, 1));
+        else if (event->reason() == Qt::BacktabFocusReason)
+            d->setFocusedButton(d->nextFocusButton(TransportButtonCount, -1));
+        update(d->buttonUpdateRect(d->focusedButton));
+    }
+    QWidget::focusInEvent(event);
+}
+
+void TimePlayControl::focusOutEvent(QFocusEvent *event)
+{
+    if (d->buttonMode == PaintedButtons)
+        update(d->buttonUpdateRect(d->focusedButton));
+    QWidget::focusOutEvent(event);
+}
+
+bool TimePlayControl::focusNextPrevChild(bool next)
+{
+    // 先在控件内的按钮间移动，到头后再交给下一个控件
+    if (d->buttonMode == PaintedButtons && hasFocus()) {
+        int button = d->nextFocusButton(d->focusedButton, next ? 1 : -1);
+        if (button != kNoButton) {
+            d->setFocusedButton(button);
+            return true;
+        }
+    }
+    return QWidget::focusNextPrevChild(next);
 }
\ No newline at end of file
@@ -6,6 +6,12 @@
 #include <QHBoxLayout>
 #include <QTimer>
 #include <QDateTime>
+#include <QVector>
+#include <QPair>
+#include <QSharedPointer>
+#include "playhead.h"
+
+class PlaybackClock;
 
 /**
  * @brief 时间轴播放控件
@@ -25,10 +31,23 @@ public:
         Playing,    // 播放中
         Paused      // 暂停
     };
+    
+    /**
+     * @brief 播放按钮实现方式
+     */
+    enum ButtonMode {
+        WidgetButtons,  // 带样式表的 QPushButton
+        PaintedButtons  // 由 paintEvent 从共享贴图绘制的点击区域，适合大量控件同屏
+    };
 
 public:
     explicit TimePlayControl(QWidget *parent = nullptr);
+    explicit TimePlayControl(ButtonMode mode, QWidget *parent = nullptr);
     ~TimePlayControl() override;
+    
+    // 按钮实现方式，两种方式的信号和键盘操作一致
+    void setButtonMode(ButtonMode mode);
+    ButtonMode buttonMode() const;
 
     // 播放控制
     void play();
@@ -44,22 +63,86 @@ public:
     // 时间设置
     void setCurrentTime(const QDateTime &time);
     QDateTime currentTime() const;
+    QDateTime currentStepTime() const;
     
     void setTimeRange(const QDateTime &startTime, const QDateTime &endTime);
     QDateTime startTime() const;
     QDateTime endTime() const;
     
-    // 播放速度设置
+    // 播放速度设置（负值表示倒放）
     void setPlaySpeed(double speed);
     double playSpeed() const;
+    void rampPlaySpeed(double targetSpeed, int durationMs);
+    
+    // 刷新间隔（毫秒），与播放速度无关，即时钟源的节拍间隔；系统时钟默认取屏幕刷新周期
+    void setRefreshInterval(int msecs);
+    int refreshInterval() const;
+    
+    // 时钟源：nullptr 表示系统时钟。注入 VirtualPlaybackClock 后时间和节拍都由 advance() 驱动，
+    // 不需要等待真实定时器，播放头快照也按虚拟时间采样；控件不接管外部时钟的所有权
+    void setClockSource(PlaybackClock *clock);
+    PlaybackClock *clockSource() const;
     
     // 步进间隔设置（秒）
     void setStepInterval(int seconds);
     int stepInterval() const;
+    
+    // 连续播放：currentTimeChanged 按刷新节奏携带非整步的媒体时间，
+    // currentStepChanged 仍只在越过步进边界时发出
+    void setContinuousPlayback(bool enabled);
+    bool isContinuousPlayback() const;
+    
+    // 事件索引（自纪元毫秒，例如 TimeContral::timeItemStartTimes()），用于按事件跳转
+    void setEventTimes(const QVector<qint64> &msecsSinceEpoch);
+    QVector<qint64> eventTimes() const;
+    bool seekToNextEvent();
+    bool seekToPreviousEvent();
+    
+    // 事件时间段（自纪元毫秒，例如 TimeContral::timeSpanRanges()）：空档快进把段内
+    // 任何位置都视为密集区，长时间段不会被快进
+    void setEventSpans(const QVector<QPair<qint64, qint64>> &msecsSinceEpoch);
+    QVector<QPair<qint64, qint64>> eventSpans() const;
+    
+    // 片段播放列表（自纪元毫秒，例如 TimeContral::timeSpanRanges()）：播到片段边界时
+    // 在同一节拍内接到相邻片段继续播放，片段之间的空白跳过；列表播完且未循环时暂停在边界。
+    // 片段裁剪到播放范围内，segments() 返回裁剪后的列表
+    void setSegments(const QVector<QPair<qint64, qint64>> &msecsSinceEpoch);
+    QVector<QPair<qint64, qint64>> segments() const;
+    void clearSegments();
+    int currentSegment() const;
+    void setSegmentLooping(bool enabled);
+    bool isSegmentLooping() const;
+    
+    // A-B 循环：只含一个片段的循环播放列表
+    void setLoopRange(const QDateTime &a, const QDateTime &b);
+    
+    // 自适应播放：与最近事件时刻和事件时间段相距超过阈值（秒）的空档按倍率快进
+    void setSkipGapsEnabled(bool enabled);
+    bool isSkipGapsEnabled() const;
+    void setGapThreshold(int seconds);
+    int gapThreshold() const;
+    void setGapSpeedFactor(double factor);
+    double gapSpeedFactor() const;
+    
+    // 预取窗口：覆盖未来 lookahead 毫秒（墙钟）内将播放的媒体时间，随速度与方向伸缩
+    void setPrefetchLookahead(int msecs);
+    int prefetchLookahead() const;
+    QDateTime prefetchWindowStart() const;
+    QDateTime prefetchWindowEnd() const;
+    
+    // 播放头快照：解码、分析等工作线程无锁读取，不依赖 GUI 线程的信号；
+    // 发布器由共享指针持有，控件销毁后读取方仍可安全访问最后一次发布的状态
+    QSharedPointer<const PlayheadPublisher> playheadPublisher() const;
+    PlayheadSnapshot playheadSnapshot() const;
 
 signals:
     void playStateChanged(PlayState state);
     void currentTimeChanged(const QDateTime &time);
+    void currentStepChanged(const QDateTime &time);
+    void playSpeedChanged(double speed);
+    void gapSkippingChanged(bool skipping);
+    void segmentChanged(int index);
+    void prefetchWindowChanged(const QDateTime &from, const QDateTime &to);
     void playClicked();
     void pauseClicked();
     void stopClicked();
@@ -69,6 +152,14 @@ signals:
 protected:
     void paintEvent(QPaintEvent *event) override;
     void resizeEvent(QResizeEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void leaveEvent(QEvent *event) override;
+    void keyPressEvent(QKeyEvent *event) override;
+    void focusInEvent(QFocusEvent *event) override;
+    void focusOutEvent(QFocusEvent *event) override;
+    bool focusNextPrevChild(bool next) override;
 
 private slots:
     void onPlayButtonClicked();
@@ -78,9 +169,16 @@ private slots:
 
 private:
     void setupUI();
+    void clearButtons();
     void updateButtonStates();
+    void updatePrefetchWindow();
+    void applySegments();
+    void publishPlayhead();
     void drawBackground(QPainter &painter);
     void createCircularButton(QPushButton *button, const QString &iconText);
+    void drawPaintedButtons(QPainter &painter, const QRect &dirtyRect);
+    void layoutPaintedButtons();
+    void activatePaintedButton(int button);
     
 private:
     class Private;
@@ -0,0 +1,149 @@
+#include "framedriver.h"
+#include <QTimer>
+#include <QCoreApplication>
+#include <QGuiApplication>
+#include <QScreen>
+
+namespace {
+
+// 默认帧间隔取屏幕刷新周期
+int displayFrameInterval()
+{
+    QScreen *screen = QGuiApplication::primaryScreen();
+    qreal hz = screen ? screen->refreshRate() : 60.0;
+    if (hz < 1.0)
+        hz = 60.0;
+    return qMax(1, qRound(1000.0 / hz));
+}
+
+} // namespace
+
+FrameDriver *FrameDriver::instance()
+{
+    static QPointer<FrameDriver> driver;
+    if (!driver)
+        driver = new FrameDriver(QCoreApplication::instance());
+    return driver;
+}
+
+FrameDriver::FrameDriver(QObject *parent)
+    : QObject(parent)
+    , m_frameTimer(new QTimer(this))
+    , m_dispatching(false)
+    , m_needsCompact(false)
+{
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    m_frameTimer->setInterval(displayFrameInterval());
+    connect(m_frameTimer, &QTimer::timeout, this, &FrameDriver::onFrame);
+    m_clock.start();
+}
+
+void FrameDriver::subscribe(QObject *owner, const FrameCallback &callback)
+{
+    if (!owner || !callback)
+        return;
+
+    for (Subscriber &subscriber : m_subscribers) {
+        if (subscriber.owner == owner) {
+            subscriber.callback = callback;
+            return;
+        }
+    }
+
+    // 首次订阅时跟踪 owner 的销毁，避免回调访问已析构的对象
+    connect(owner, &QObject::destroyed, this, &FrameDriver::unsubscribe, Qt::UniqueConnection);
+    m_subscribers.append({owner, callback});
+
+    if (!m_frameTimer->isActive()) {
+        m_frameTimer->start();
+        emit activeChanged(true);
+    }
+}
+
+void FrameDriver::unsubscribe(QObject *owner)
+{
+    if (owner)
+        disconnect(owner, &QObject::destroyed, this, &FrameDriver::unsubscribe);
+
+    // owner 析构时 QPointer 已先被置空，顺带清理所有失效的订阅
+    for (int i = m_subscribers.size() - 1; i >= 0; --i) {
+        Subscriber &subscriber = m_subscribers[i];
+        if (subscriber.owner && subscriber.owner != owner)
+            continue;
+
+        // 分发过程中只清空回调，分发结束后再压缩列表
+        if (m_dispatching) {
+            subscriber.owner = nullptr;
+            subscriber.callback = nullptr;
+            m_needsCompact = true;
+        } else {
+            m_subscribers.remove(i);
+        }
+    }
+
+    if (!m_dispatching && m_subscribers.isEmpty() && m_frameTimer->isActive()) {
+        m_frameTimer->stop();
+        emit activeChanged(false);
+    }
+}
+
+bool FrameDriver::isSubscribed(QObject *owner) const
+{
+    for (const Subscriber &subscriber : m_subscribers) {
+        if (owner && subscriber.owner == owner && subscriber.callback)
+            return true;
+    }
+    return false;
+}
+
+void FrameDriver::setFrameInterval(int msecs)
+{
+    if (msecs > 0)
+        m_frameTimer->setInterval(msecs);
+}
+
+int FrameDriver::frameInterval() const
+{
+    return m_frameTimer->interval();
+}
+
+qint64 FrameDriver::now() const
+{
+    return m_clock.elapsed();
+}
+
+bool FrameDriver::isActive() const
+{
+    return m_frameTimer->isActive();
+}
+
+void FrameDriver::onFrame()
+{
+    qint64 frameTime = m_clock.elapsed();
+
+    // 回调中新增的订阅者在本帧内也会被调用，例如播放推进后立即合并推送的时钟
+    m_dispatching = true;
+    for (int i = 0; i < m_subscribers.size(); ++i) {
+        FrameCallback callback = m_subscribers.at(i).callback;
+        if (callback && m_subscribers.at(i).owner)
+            callback(frameTime);
+    }
+    m_dispatching = false;
+
+    if (m_needsCompact)
+        compact();
+
+    if (m_subscribers.isEmpty()) {
+        m_frameTimer->stop();
+        emit activeChanged(false);
+    }
+}
+
+void FrameDriver::compact()
+{
+    m_needsCompact = false;
+    for (int i = m_subscribers.size() - 1; i >= 0; --i) {
+        if (!m_subscribers.at(i).callback || !m_subscribers.at(i).owner)
+            m_subscribers.remove(i);
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef FRAMEDRIVER_H
+#define FRAMEDRIVER_H
+
+#include <QObject>
+#include <QVector>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <functional>
+
+class QTimer;
+
+/**
+ * @brief 进程级帧驱动器
+ * 
+ * 所有动画与播放共用一个按屏幕刷新周期触发的精确定时器。控件在有动画或正在播放时
+ * 订阅，结束后退订；没有订阅者时定时器停止，不再唤醒事件循环
+ */
+class FrameDriver : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 帧回调，参数为本帧的单调时钟时间（毫秒）
+    using FrameCallback = std::function<void(qint64 frameTimeMs)>;
+
+    static FrameDriver *instance();
+    
+    // 订阅与退订：同一个 owner 只保留一个回调，owner 销毁时自动退订
+    void subscribe(QObject *owner, const FrameCallback &callback);
+    void unsubscribe(QObject *owner);
+    bool isSubscribed(QObject *owner) const;
+    
+    // 帧间隔（毫秒），默认取屏幕刷新周期
+    void setFrameInterval(int msecs);
+    int frameInterval() const;
+    
+    // 单调时钟当前时间（毫秒），与帧回调参数同一时基
+    qint64 now() const;
+    bool isActive() const;
+
+signals:
+    void activeChanged(bool active);
+
+private slots:
+    void onFrame();
+
+private:
+    explicit FrameDriver(QObject *parent = nullptr);
+    void compact();
+    
+private:
+    struct Subscriber {
+        QPointer<QObject> owner;
+        FrameCallback callback;
+    };
+    
+    QVector<Subscriber> m_subscribers;
+    QTimer *m_frameTimer;
+    QElapsedTimer m_clock;
+    bool m_dispatching;
+    bool m_needsCompact;
+};
+
+#endif // FRAMEDRIVER_H
@@ -0,0 +1,210 @@
+#include "timelineclock.h"
+#include "timecontral.h"
+#include "timeplaycontrol.h"
+#include "datepicker.h"
+#include "framedriver.h"
+
+TimelineClock::TimelineClock(QObject *parent)
+    : QObject(parent)
+    , m_playing(false)
+    , m_pendingChanges(NoChange)
+{
+}
+
+TimelineClock::~TimelineClock()
+{
+}
+
+void TimelineClock::setCurrentTime(const QDateTime &time)
+{
+    if (!time.isValid() || time == m_currentTime)
+        return;
+
+    m_currentTime = time;
+    markChanged(TimeChange);
+}
+
+QDateTime TimelineClock::currentTime() const
+{
+    return m_currentTime;
+}
+
+void TimelineClock::setVisibleRange(const QDateTime &startTime, const QDateTime &endTime)
+{
+    if (!startTime.isValid() || startTime >= endTime)
+        return;
+    if (startTime == m_visibleStartTime && endTime == m_visibleEndTime)
+        return;
+
+    m_visibleStartTime = startTime;
+    m_visibleEndTime = endTime;
+    markChanged(RangeChange);
+}
+
+QDateTime TimelineClock::visibleStartTime() const
+{
+    return m_visibleStartTime;
+}
+
+QDateTime TimelineClock::visibleEndTime() const
+{
+    return m_visibleEndTime;
+}
+
+void TimelineClock::setPlaying(bool playing)
+{
+    if (m_playing == playing)
+        return;
+
+    m_playing = playing;
+    markChanged(PlayStateChange);
+}
+
+bool TimelineClock::isPlaying() const
+{
+    return m_playing;
+}
+
+void TimelineClock::attach(TimeContral *timeline)
+{
+    if (!timeline || m_timelines.contains(timeline))
+        return;
+
+    if (!m_currentTime.isValid())
+        m_currentTime = timeline->currentTime();
+    if (!m_visibleStartTime.isValid()) {
+        m_visibleStartTime = timeline->visibleStartTime();
+        m_visibleEndTime = timeline->visibleEndTime();
+    }
+
+    m_timelines.append(timeline);
+    pushTo(timeline, TimeChange | RangeChange);
+
+    connect(timeline, &TimeContral::currentTimeChanged, this, &TimelineClock::setCurrentTime);
+    connect(timeline, &TimeContral::visibleTimeRangeChanged, this, &TimelineClock::setVisibleRange);
+}
+
+void TimelineClock::attach(TimePlayControl *player)
+{
+    if (!player || m_players.contains(player))
+        return;
+
+    if (!m_currentTime.isValid())
+        m_currentTime = player->currentTime();
+    if (!m_visibleStartTime.isValid()) {
+        m_visibleStartTime = player->startTime();
+        m_visibleEndTime = player->endTime();
+    }
+
+    m_players.append(player);
+    pushTo(player, TimeChange | RangeChange | PlayStateChange);
+
+    connect(player, &TimePlayControl::currentTimeChanged, this, &TimelineClock::setCurrentTime);
+    connect(player, &TimePlayControl::playStateChanged, this, [this](TimePlayControl::PlayState state) {
+        setPlaying(state == TimePlayControl::Playing);
+    });
+}
+
+void TimelineClock::attach(DatePicker *picker)
+{
+    if (!picker || m_pickers.contains(picker))
+        return;
+
+    if (!m_currentTime.isValid())
+        m_currentTime = QDateTime(picker->selectedDate(), QTime(12, 0, 0));
+
+    m_pickers.append(picker);
+    pushTo(picker, TimeChange);
+
+    // 换日时保持时刻和可见窗口不变，整体平移到新日期
+    connect(picker, &DatePicker::dateChanged, this, [this](const QDate &date) {
+        if (!date.isValid() || !m_currentTime.isValid() || date == m_currentTime.date())
+            return;
+        qint64 days = m_currentTime.date().daysTo(date);
+        if (m_visibleStartTime.isValid())
+            setVisibleRange(m_visibleStartTime.addDays(days), m_visibleEndTime.addDays(days));
+        setCurrentTime(m_currentTime.addDays(days));
+    });
+}
+
+void TimelineClock::detach(QObject *widget)
+{
+    if (!widget)
+        return;
+
+    disconnect(widget, nullptr, this, nullptr);
+    m_timelines.removeAll(QPointer<TimeContral>(qobject_cast<TimeContral *>(widget)));
+    m_players.removeAll(QPointer<TimePlayControl>(qobject_cast<TimePlayControl *>(widget)));
+    m_pickers.removeAll(QPointer<DatePicker>(qobject_cast<DatePicker *>(widget)));
+}
+
+void TimelineClock::markChanged(Change change)
+{
+    // 有待推送的变化时才挂到帧驱动上，在当前帧的驱动回调之后合并推送
+    m_pendingChanges |= change;
+    if (!FrameDriver::instance()->isSubscribed(this))
+        FrameDriver::instance()->subscribe(this, [this](qint64) { flush(); });
+}
+
+void TimelineClock::flush()
+{
+    FrameDriver::instance()->unsubscribe(this);
+
+    Changes changes = m_pendingChanges;
+    m_pendingChanges = NoChange;
+    if (changes == NoChange)
+        return;
+
+    // 控件在推送过程中回写的相同值会被时钟忽略；被钳制后回写的新值在本帧稍后再推送一次
+    for (const QPointer<TimeContral> &timeline : m_timelines) {
+        if (timeline)
+            pushTo(timeline, changes);
+    }
+    for (const QPointer<TimePlayControl> &player : m_players) {
+        if (player)
+            pushTo(player, changes);
+    }
+    for (const QPointer<DatePicker> &picker : m_pickers) {
+        if (picker)
+            pushTo(picker, changes);
+    }
+
+    emit changed(changes);
+}
+
+void TimelineClock::pushTo(TimeContral *timeline, Changes changes)
+{
+    // 先同步范围再同步时间；值未变化的控件不会被触碰，也不会重绘
+    if ((changes & RangeChange) && m_visibleStartTime.isValid()
+        && (timeline->visibleStartTime() != m_visibleStartTime
+            || timeline->visibleEndTime() != m_visibleEndTime)) {
+        timeline->setVisibleTimeRange(m_visibleStartTime, m_visibleEndTime);
+    }
+    if ((changes & TimeChange) && m_currentTime.isValid()) {
+        timeline->setCurrentTime(m_currentTime);
+    }
+}
+
+void TimelineClock::pushTo(TimePlayControl *player, Changes changes)
+{
+    if ((changes & RangeChange) && m_visibleStartTime.isValid()
+        && (player->startTime() != m_visibleStartTime || player->endTime() != m_visibleEndTime)) {
+        player->setTimeRange(m_visibleStartTime, m_visibleEndTime);
+    }
+    if ((changes & TimeChange) && m_currentTime.isValid()) {
+        player->setCurrentTime(m_currentTime);
+    }
+    if ((changes & PlayStateChange) && m_playing != player->isPlaying()) {
+        if (m_playing)
+            player->play();
+        else
+            player->pause();
+    }
+}
+
+void TimelineClock::pushTo(DatePicker *picker, Changes changes)
+{
+    if ((changes & TimeChange) && m_currentTime.isValid()) {
+        picker->setSelectedDate(m_currentTime.date());
+    }
+}
@@ -0,0 +1,87 @@
+#ifndef TIMELINECLOCK_H
+#define TIMELINECLOCK_H
+
+#include <QObject>
+#include <QDateTime>
+#include <QPointer>
+#include <QVector>
+
+class TimeContral;
+class TimePlayControl;
+class DatePicker;
+
+/**
+ * @brief 共享时间轴时钟
+ * 
+ * 保存当前时间、可见时间范围和播放状态，TimeContral、TimePlayControl、DatePicker
+ * 挂接到同一个时钟后，任一控件的改变只写入时钟一次，按帧合并后推送给其他控件，
+ * 每个控件每帧最多刷新一次
+ */
+class TimelineClock : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 变化类型
+     */
+    enum Change {
+        NoChange = 0x0,
+        TimeChange = 0x1,         // 当前时间
+        RangeChange = 0x2,        // 可见时间范围
+        PlayStateChange = 0x4     // 播放状态
+    };
+    Q_DECLARE_FLAGS(Changes, Change)
+
+public:
+    explicit TimelineClock(QObject *parent = nullptr);
+    ~TimelineClock() override;
+
+    // 当前时间
+    void setCurrentTime(const QDateTime &time);
+    QDateTime currentTime() const;
+    
+    // 可见时间范围（播放控件的播放范围跟随可见范围）
+    void setVisibleRange(const QDateTime &startTime, const QDateTime &endTime);
+    QDateTime visibleStartTime() const;
+    QDateTime visibleEndTime() const;
+    
+    // 播放状态
+    void setPlaying(bool playing);
+    bool isPlaying() const;
+    
+    // 挂接控件：挂接时以时钟状态为准，时钟尚无状态时采用控件当前状态
+    void attach(TimeContral *timeline);
+    void attach(TimePlayControl *player);
+    void attach(DatePicker *picker);
+    void detach(QObject *widget);
+    
+    // 立即推送尚未合并的变化
+    void flush();
+
+signals:
+    // 按帧合并后发出，携带本次合并的全部变化
+    void changed(TimelineClock::Changes changes);
+
+private:
+    void markChanged(Change change);
+    void pushTo(TimeContral *timeline, Changes changes);
+    void pushTo(TimePlayControl *player, Changes changes);
+    void pushTo(DatePicker *picker, Changes changes);
+    
+private:
+    QDateTime m_currentTime;
+    QDateTime m_visibleStartTime;
+    QDateTime m_visibleEndTime;
+    bool m_playing;
+    
+    Changes m_pendingChanges;
+    
+    QVector<QPointer<TimeContral>> m_timelines;
+    QVector<QPointer<TimePlayControl>> m_players;
+    QVector<QPointer<DatePicker>> m_pickers;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(TimelineClock::Changes)
+
+#endif // TIMELINECLOCK_H